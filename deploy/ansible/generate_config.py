@@ -29,6 +29,7 @@ with open(home+"/iroha_data/config.sample", "w") as f:
   "redis_port" : 6379,
   "max_proposal_size" : 10,
   "proposal_delay" : 5000,
+  "max_queue_size" : 10000,
   "vote_delay" : 5000,
   "load_delay" : 5000
 }}""".format(options.postgres_user, options.postgres_password)
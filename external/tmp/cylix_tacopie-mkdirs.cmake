@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/external/src/cylix_cpp_redis/tacopie"
+  "/root/repo/external/src/cylix_tacopie-build"
+  "/root/repo/external"
+  "/root/repo/external/tmp"
+  "/root/repo/external/src/cylix_tacopie-stamp"
+  "/root/repo/external/src"
+  "/root/repo/external/src/cylix_tacopie-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/external/src/cylix_tacopie-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/external/src/cylix_tacopie-stamp${cfgdir}") # cfgdir has leading slash
+endif()
@@ -39,6 +39,8 @@ namespace iroha_cli {
         &QueryResponseHandler::handleRolePermissionsResponse;
     handler_map_[QueryResponse::ResponseCase::kAssetResponse] =
         &QueryResponseHandler::handleAssetResponse;
+    handler_map_[QueryResponse::ResponseCase::kTransactionProofResponse] =
+        &QueryResponseHandler::handleTransactionProofResponse;
 
     // Error responses:
     error_handler_map_[ErrorResponse::STATEFUL_INVALID] =
@@ -53,6 +55,8 @@ namespace iroha_cli {
     error_handler_map_[ErrorResponse::WRONG_FORMAT] = "Query has wrong format";
     error_handler_map_[ErrorResponse::NO_ROLES] = "No roles in the system";
     error_handler_map_[ErrorResponse::NO_ASSET] = "No asset found";
+    error_handler_map_[ErrorResponse::NO_TRANSACTION] =
+        "No transaction found";
   }
 
   void QueryResponseHandler::handle(
@@ -136,6 +140,21 @@ namespace iroha_cli {
     log_->info("-Precision- {}", asset.precision());
   }
 
+  void QueryResponseHandler::handleTransactionProofResponse(
+      const iroha::protocol::QueryResponse &response) {
+    auto proof = response.transaction_proof_response();
+    log_->info("[Transaction Proof]");
+    log_->info("-Block Height- {}", proof.height());
+    log_->info("-Merkle Root- {}",
+               iroha::hash256_t::from_string(proof.merkle_root())
+                   .to_hexstring());
+    log_->info("-Index- {} of {}", proof.index(), proof.leaves_number());
+    std::for_each(proof.path().begin(), proof.path().end(), [this](auto node) {
+      log_->info("-Path Node- {}",
+                 iroha::hash256_t::from_string(node).to_hexstring());
+    });
+  }
+
   void QueryResponseHandler::handleTransactionsResponse(
       const iroha::protocol::QueryResponse &response) {
     auto txs = response.transactions_response().transactions();
@@ -60,6 +60,8 @@ namespace iroha_cli {
     void handleRolesResponse(const iroha::protocol::QueryResponse& response);
     void handleRolePermissionsResponse(const iroha::protocol::QueryResponse& response);
     void handleAssetResponse(const iroha::protocol::QueryResponse& response);
+    void handleTransactionProofResponse(
+        const iroha::protocol::QueryResponse& response);
     // -- --
     using Handler =
         void (QueryResponseHandler::*)(const iroha::protocol::QueryResponse&);
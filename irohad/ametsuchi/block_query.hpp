@@ -89,6 +89,14 @@ namespace iroha {
        */
       virtual boost::optional<model::Transaction> getTxByHashSync(
           const std::string &hash) = 0;
+
+      /**
+       * Synchronously gets block which contains transaction with given hash
+       * @param hash - hash of transaction
+       * @return block or boost::none
+       */
+      virtual boost::optional<model::Block> getBlockByTxHashSync(
+          const std::string &hash) = 0;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
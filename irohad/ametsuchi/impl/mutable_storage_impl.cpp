@@ -44,10 +44,11 @@ namespace iroha {
     }
 
     void MutableStorageImpl::index_block(uint64_t height, model::Block block) {
+      auto hashes = iroha::hash(block.transactions);
       for (size_t i = 0; i < block.transactions.size(); i++) {
         auto tx = block.transactions.at(i);
         auto account_id = tx.creator_account_id;
-        auto hash = iroha::hash(tx).to_string();
+        auto hash = hashes.at(i).to_string();
 
         // tx hash -> block where hash is stored
         index_->set(hash, std::to_string(height));
@@ -104,11 +105,30 @@ namespace iroha {
                            execute_command);
       };
 
+      return applyBlock(block, function, [&] {
+        return std::all_of(block.transactions.begin(),
+                           block.transactions.end(),
+                           execute_transaction);
+      });
+    }
+
+    bool MutableStorageImpl::replay(
+        const model::Block &block,
+        const WriteSet &write_set,
+        std::function<bool(const model::Block &, WsvQuery &, const hash256_t &)>
+            function) {
+      return applyBlock(block, function, [&] {
+        return ametsuchi::replay(write_set, *executor_);
+      });
+    }
+
+    bool MutableStorageImpl::applyBlock(
+        const model::Block &block,
+        std::function<bool(const model::Block &, WsvQuery &, const hash256_t &)>
+            function,
+        std::function<bool()> execute) {
       transaction_->exec("SAVEPOINT savepoint_;");
-      auto result = function(block, *wsv_, top_hash_)
-          and std::all_of(block.transactions.begin(),
-                          block.transactions.end(),
-                          execute_transaction);
+      auto result = function(block, *wsv_, top_hash_) and execute();
 
       if (result) {
         block_store_.insert(std::make_pair(block.height, block));
@@ -43,11 +43,27 @@ namespace iroha {
                                     WsvQuery &, const hash256_t &)>
                  function) override;
 
+      bool replay(const model::Block &block,
+                  const WriteSet &write_set,
+                  std::function<bool(const model::Block &,
+                                     WsvQuery &, const hash256_t &)>
+                  function) override;
+
       ~MutableStorageImpl() override;
 
      private:
       void index_block(uint64_t height, model::Block block);
 
+      /**
+       * Check block with function and modify state with execute in the
+       * savepoint, store the block if both succeeded
+       */
+      bool applyBlock(const model::Block &block,
+                      std::function<bool(const model::Block &,
+                                         WsvQuery &, const hash256_t &)>
+                      function,
+                      std::function<bool()> execute);
+
       hash256_t top_hash_;
       // ordered collection is used to enforce block insertion order in
       // StorageImpl::commit
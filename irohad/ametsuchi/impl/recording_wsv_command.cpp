@@ -0,0 +1,144 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/recording_wsv_command.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    RecordingWsvCommand::RecordingWsvCommand(WsvCommand &command,
+                                             WriteSet &write_set)
+        : command_(command), write_set_(write_set) {}
+
+    bool RecordingWsvCommand::record(std::function<bool(WsvCommand &)> change) {
+      if (not change(command_)) {
+        return false;
+      }
+      write_set_.push_back(std::move(change));
+      return true;
+    }
+
+    bool RecordingWsvCommand::insertRole(const std::string &role_name) {
+      return record([role_name](WsvCommand &command) {
+        return command.insertRole(role_name);
+      });
+    }
+
+    bool RecordingWsvCommand::insertAccountRole(const std::string &account_id,
+                                                const std::string &role_name) {
+      return record([account_id, role_name](WsvCommand &command) {
+        return command.insertAccountRole(account_id, role_name);
+      });
+    }
+
+    bool RecordingWsvCommand::insertRolePermissions(
+        const std::string &role_id, const std::set<std::string> &permissions) {
+      return record([role_id, permissions](WsvCommand &command) {
+        return command.insertRolePermissions(role_id, permissions);
+      });
+    }
+
+    bool RecordingWsvCommand::insertAccount(const model::Account &account) {
+      return record([account](WsvCommand &command) {
+        return command.insertAccount(account);
+      });
+    }
+
+    bool RecordingWsvCommand::updateAccount(const model::Account &account) {
+      return record([account](WsvCommand &command) {
+        return command.updateAccount(account);
+      });
+    }
+
+    bool RecordingWsvCommand::insertAsset(const model::Asset &asset) {
+      return record(
+          [asset](WsvCommand &command) { return command.insertAsset(asset); });
+    }
+
+    bool RecordingWsvCommand::upsertAccountAsset(
+        const model::AccountAsset &asset) {
+      return record([asset](WsvCommand &command) {
+        return command.upsertAccountAsset(asset);
+      });
+    }
+
+    bool RecordingWsvCommand::insertSignatory(const pubkey_t &signatory) {
+      return record([signatory](WsvCommand &command) {
+        return command.insertSignatory(signatory);
+      });
+    }
+
+    bool RecordingWsvCommand::insertAccountSignatory(
+        const std::string &account_id, const pubkey_t &signatory) {
+      return record([account_id, signatory](WsvCommand &command) {
+        return command.insertAccountSignatory(account_id, signatory);
+      });
+    }
+
+    bool RecordingWsvCommand::deleteAccountSignatory(
+        const std::string &account_id, const pubkey_t &signatory) {
+      return record([account_id, signatory](WsvCommand &command) {
+        return command.deleteAccountSignatory(account_id, signatory);
+      });
+    }
+
+    bool RecordingWsvCommand::deleteSignatory(const pubkey_t &signatory) {
+      return record([signatory](WsvCommand &command) {
+        return command.deleteSignatory(signatory);
+      });
+    }
+
+    bool RecordingWsvCommand::insertPeer(const model::Peer &peer) {
+      return record(
+          [peer](WsvCommand &command) { return command.insertPeer(peer); });
+    }
+
+    bool RecordingWsvCommand::deletePeer(const model::Peer &peer) {
+      return record(
+          [peer](WsvCommand &command) { return command.deletePeer(peer); });
+    }
+
+    bool RecordingWsvCommand::insertDomain(const model::Domain &domain) {
+      return record([domain](WsvCommand &command) {
+        return command.insertDomain(domain);
+      });
+    }
+
+    bool RecordingWsvCommand::insertAccountGrantablePermission(
+        const std::string &permittee_account_id,
+        const std::string &account_id,
+        const std::string &permission_id) {
+      return record([permittee_account_id, account_id, permission_id](
+          WsvCommand &command) {
+        return command.insertAccountGrantablePermission(
+            permittee_account_id, account_id, permission_id);
+      });
+    }
+
+    bool RecordingWsvCommand::deleteAccountGrantablePermission(
+        const std::string &permittee_account_id,
+        const std::string &account_id,
+        const std::string &permission_id) {
+      return record([permittee_account_id, account_id, permission_id](
+          WsvCommand &command) {
+        return command.deleteAccountGrantablePermission(
+            permittee_account_id, account_id, permission_id);
+      });
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
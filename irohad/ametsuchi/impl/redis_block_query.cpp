@@ -185,7 +185,7 @@ namespace iroha {
           });
     }
 
-    boost::optional<model::Transaction> RedisBlockQuery::getTxByHashSync(
+    boost::optional<model::Block> RedisBlockQuery::getBlockByTxHashSync(
         const std::string &hash) {
       return getBlockId(hash) |
           [this](auto blockId) { return block_store_.get(blockId); } |
@@ -193,7 +193,12 @@ namespace iroha {
             return model::converters::stringToJson(bytesToString(bytes));
           }
       | [this](const auto &json) { return serializer_.deserialize(json); }
-      | [&](const auto &block) {
+      | [](const auto &block) { return boost::make_optional(block); };
+    }
+
+    boost::optional<model::Transaction> RedisBlockQuery::getTxByHashSync(
+        const std::string &hash) {
+      return getBlockByTxHashSync(hash) | [&](const auto &block) {
           auto it = std::find_if(
               block.transactions.begin(),
               block.transactions.end(),
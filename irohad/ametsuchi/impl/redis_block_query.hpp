@@ -47,6 +47,9 @@ namespace iroha {
       boost::optional<model::Transaction> getTxByHashSync(
           const std::string &hash) override;
 
+      boost::optional<model::Block> getBlockByTxHashSync(
+          const std::string &hash) override;
+
       rxcpp::observable<model::Block> getBlocks(uint32_t height,
                                                 uint32_t count) override;
 
@@ -19,6 +19,7 @@
 
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
+#include "ametsuchi/impl/recording_wsv_command.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -29,7 +30,9 @@ namespace iroha {
         : connection_(std::move(connection)),
           transaction_(std::move(transaction)),
           wsv_(std::make_unique<PostgresWsvQuery>(*transaction_)),
-          executor_(std::make_unique<PostgresWsvCommand>(*transaction_)),
+          command_(std::make_unique<PostgresWsvCommand>(*transaction_)),
+          executor_(
+              std::make_unique<RecordingWsvCommand>(*command_, write_set_)),
           command_executors_(std::move(command_executors)) {
       transaction_->exec("BEGIN;");
     }
@@ -44,6 +47,7 @@ namespace iroha {
             executor->execute(*command, *wsv_, *executor_);
       };
 
+      auto recorded = write_set_.size();
       transaction_->exec("SAVEPOINT savepoint_;");
       auto result = function(transaction, *wsv_) &&
           std::all_of(transaction.commands.begin(),
@@ -52,10 +56,34 @@ namespace iroha {
         transaction_->exec("RELEASE SAVEPOINT savepoint_;");
       } else {
         transaction_->exec("ROLLBACK TO SAVEPOINT savepoint_;");
+        write_set_.resize(recorded);
       }
       return result;
     }
 
+    bool TemporaryWsvImpl::replay(const WriteSet &write_set) {
+      transaction_->exec("SAVEPOINT savepoint_;");
+      auto result = ametsuchi::replay(write_set, *command_);
+      if (result) {
+        transaction_->exec("RELEASE SAVEPOINT savepoint_;");
+        write_set_.insert(write_set_.end(), write_set.begin(), write_set.end());
+      } else {
+        transaction_->exec("ROLLBACK TO SAVEPOINT savepoint_;");
+      }
+      return result;
+    }
+
+    const WriteSet &TemporaryWsvImpl::writeSet() const {
+      return write_set_;
+    }
+
+    void TemporaryWsvImpl::reset() {
+      // connection is kept, new transaction sees committed blocks
+      transaction_->exec("ROLLBACK;");
+      transaction_->exec("BEGIN;");
+      write_set_.clear();
+    }
+
     TemporaryWsvImpl::~TemporaryWsvImpl() { transaction_->exec("ROLLBACK;"); }
   }  // namespace ametsuchi
 }  // namespace iroha
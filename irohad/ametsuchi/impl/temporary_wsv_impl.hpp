@@ -38,12 +38,21 @@ namespace iroha {
                                     WsvQuery &)>
                  function) override;
 
+      bool replay(const WriteSet &write_set) override;
+
+      const WriteSet &writeSet() const override;
+
+      void reset() override;
+
       ~TemporaryWsvImpl() override;
 
      private:
       std::unique_ptr<pqxx::lazyconnection> connection_;
       std::unique_ptr<pqxx::nontransaction> transaction_;
       std::unique_ptr<WsvQuery> wsv_;
+      std::unique_ptr<WsvCommand> command_;
+      WriteSet write_set_;
+      // records changes of command_ to write_set_
       std::unique_ptr<WsvCommand> executor_;
       std::shared_ptr<model::CommandExecutorFactory> command_executors_;
     };
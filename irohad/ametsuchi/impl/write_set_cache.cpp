@@ -0,0 +1,57 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/write_set_cache.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    WriteSetCache::WriteSetCache(size_t capacity)
+        : capacity_(std::max<size_t>(capacity, 1)) {}
+
+    void WriteSetCache::insert(const hash256_t &block_hash,
+                               WriteSet write_set) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto key = block_hash.to_string();
+      if (write_sets_.count(key) == 0) {
+        order_.push_back(key);
+      }
+      write_sets_[key] = std::move(write_set);
+      while (order_.size() > capacity_) {
+        write_sets_.erase(order_.front());
+        order_.pop_front();
+      }
+    }
+
+    nonstd::optional<WriteSet> WriteSetCache::extract(
+        const hash256_t &block_hash) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto key = block_hash.to_string();
+      auto it = write_sets_.find(key);
+      if (it == write_sets_.end()) {
+        return nonstd::nullopt;
+      }
+      auto write_set = std::move(it->second);
+      write_sets_.erase(it);
+      order_.erase(std::find(order_.begin(), order_.end(), key));
+      return write_set;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
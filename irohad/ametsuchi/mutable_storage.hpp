@@ -21,6 +21,7 @@
 #include <ametsuchi/block_query.hpp>
 #include <ametsuchi/wsv_command.hpp>
 #include <ametsuchi/wsv_query.hpp>
+#include <ametsuchi/write_set.hpp>
 
 namespace iroha {
   namespace ametsuchi {
@@ -50,6 +51,23 @@ namespace iroha {
                                             const hash256_t &)>
                              function) = 0;
 
+      /**
+       * Applies a block to current mutable state by replaying changes
+       * already made by its transactions, without executing them
+       * @param block Block to be applied
+       * @param write_set Changes made by transactions of the block on the
+       * state of its previous block
+       * @param function Function that specifies the logic used to apply the
+       * block, same as in apply
+       * @return True if block was successfully applied, false otherwise.
+       * Nothing is applied on failure.
+       */
+      virtual bool replay(const model::Block &block,
+                          const WriteSet &write_set,
+                          std::function<bool(const model::Block &, WsvQuery &,
+                                             const hash256_t &)>
+                              function) = 0;
+
       virtual ~MutableStorage() = default;
     };
 
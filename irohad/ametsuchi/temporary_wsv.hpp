@@ -18,6 +18,7 @@
 #ifndef IROHA_TEMPORARYWSV_HPP
 #define IROHA_TEMPORARYWSV_HPP
 
+#include <ametsuchi/write_set.hpp>
 #include <ametsuchi/wsv_command.hpp>
 #include <ametsuchi/wsv_query.hpp>
 #include <functional>
@@ -52,6 +53,28 @@ namespace iroha {
           std::function<bool(const model::Transaction &, WsvQuery &)>
               function) = 0;
 
+      /**
+       * Applies changes recorded on another temporary wsv created from the
+       * same state. Changes must not depend on transactions applied to this
+       * wsv.
+       * @param write_set - changes to apply
+       * @return True if all changes were applied, false otherwise. Nothing is
+       * applied on failure.
+       */
+      virtual bool replay(const WriteSet &write_set) = 0;
+
+      /**
+       * @return changes made by successfully applied transactions and
+       * replayed write sets, in order of application
+       */
+      virtual const WriteSet &writeSet() const = 0;
+
+      /**
+       * Discard all changes, so wsv can be reused from the current state
+       * of ledger
+       */
+      virtual void reset() = 0;
+
       virtual ~TemporaryWsv() = default;
     };
   }  // namespace ametsuchi
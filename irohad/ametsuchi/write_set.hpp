@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_WRITE_SET_HPP
+#define IROHA_WRITE_SET_HPP
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "ametsuchi/wsv_command.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Changes of world state view made by applied transactions, in order of
+     * execution. Replaying them on the state they were recorded on gives the
+     * same result as executing the transactions again, without validation
+     * and queries.
+     */
+    using WriteSet = std::vector<std::function<bool(WsvCommand &)>>;
+
+    /**
+     * Replay changes on world state view
+     * @param write_set - changes to replay
+     * @param command - world state view to modify
+     * @return true if all changes were applied, false otherwise
+     */
+    inline bool replay(const WriteSet &write_set, WsvCommand &command) {
+      return std::all_of(
+          write_set.begin(), write_set.end(), [&command](const auto &change) {
+            return change(command);
+          });
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WRITE_SET_HPP
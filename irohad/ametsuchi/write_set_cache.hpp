@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_WRITE_SET_CACHE_HPP
+#define IROHA_WRITE_SET_CACHE_HPP
+
+#include <deque>
+#include <mutex>
+#include <nonstd/optional.hpp>
+#include <unordered_map>
+
+#include "ametsuchi/write_set.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Keeps write sets of blocks created by this peer until they are
+     * committed, so that the block is not executed one more time
+     */
+    class WriteSetCache {
+     public:
+      /**
+       * @param capacity - maximal number of kept write sets, the oldest one
+       * is dropped on overflow
+       */
+      explicit WriteSetCache(size_t capacity);
+
+      /**
+       * Store write set of the block
+       * @param block_hash - hash of the block
+       * @param write_set - changes made by transactions of the block
+       */
+      void insert(const hash256_t &block_hash, WriteSet write_set);
+
+      /**
+       * Remove write set of the block from the cache
+       * @param block_hash - hash of the block
+       * @return write set if present, nullopt otherwise
+       */
+      nonstd::optional<WriteSet> extract(const hash256_t &block_hash);
+
+     private:
+      size_t capacity_;
+      std::unordered_map<std::string, WriteSet> write_sets_;
+      // insertion order, for eviction
+      std::deque<std::string> order_;
+      std::mutex mutex_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WRITE_SET_CACHE_HPP
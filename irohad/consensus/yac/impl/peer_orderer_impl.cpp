@@ -17,10 +17,26 @@
 
 #include "consensus/yac/impl/peer_orderer_impl.hpp"
 
+#include <random>
+
+#include "crypto/hash.hpp"
+
 namespace iroha {
   namespace consensus {
     namespace yac {
 
+      void PeerOrdererImpl::permute(std::vector<model::Peer> &peers,
+                                    const std::string &seed) {
+        auto digest = iroha::sha3_256(seed);
+        std::seed_seq seq(digest.begin(), digest.end());
+        // mt19937_64 sequence is fixed by the standard, unlike std::shuffle
+        // and distributions, so every peer gets the same permutation
+        std::mt19937_64 generator(seq);
+        for (auto i = peers.size(); i > 1; --i) {
+          std::swap(peers[i - 1], peers[generator() % i]);
+        }
+      }
+
       PeerOrdererImpl::PeerOrdererImpl(
           std::shared_ptr<ametsuchi::PeerQuery> peer_query)
           : query_(std::move(peer_query)) {}
@@ -33,8 +49,11 @@ namespace iroha {
 
       nonstd::optional<ClusterOrdering> PeerOrdererImpl::getOrdering(
           YacHash hash) {
-        // TODO 01/08/17 Muratov: implement effective ordering based on hash value IR-504
-        return getInitialOrdering();
+        // block hashes may differ between peers, proposal hash is common
+        return query_->getLedgerPeers() | [&hash](auto peers) {
+          permute(peers, hash.proposal_hash.to_string());
+          return nonstd::make_optional<ClusterOrdering>(peers);
+        };
       }
     }  // namespace yac
   }    // namespace consensus
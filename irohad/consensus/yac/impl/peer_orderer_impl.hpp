@@ -18,6 +18,9 @@
 #ifndef IROHA_PEER_ORDERER_IMPL_HPP
 #define IROHA_PEER_ORDERER_IMPL_HPP
 
+#include <string>
+#include <vector>
+
 #include "ametsuchi/peer_query.hpp"
 #include "consensus/yac/yac_peer_orderer.hpp"
 
@@ -32,8 +35,20 @@ namespace iroha {
 
         nonstd::optional<ClusterOrdering> getInitialOrdering() override;
 
+        /**
+         * Ledger peers permuted with proposal hash as a seed, so leader
+         * collecting votes changes from round to round
+         */
         nonstd::optional<ClusterOrdering> getOrdering(YacHash hash) override;
 
+        /**
+         * Deterministic permutation of peers
+         * @param peers - collection to permute in place
+         * @param seed - value selecting the permutation
+         */
+        static void permute(std::vector<model::Peer> &peers,
+                            const std::string &seed);
+
        private:
         std::shared_ptr<ametsuchi::PeerQuery> query_;
       };
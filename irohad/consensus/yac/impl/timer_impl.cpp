@@ -16,23 +16,26 @@
  */
 
 #include "consensus/yac/impl/timer_impl.hpp"
-#include <iostream>
 
 namespace iroha {
   namespace consensus {
     namespace yac {
+      TimerImpl::TimerImpl(std::shared_ptr<TimerWheel> wheel)
+          : wheel_(std::move(wheel)) {}
+
       void TimerImpl::invokeAfterDelay(uint64_t millis,
                                        std::function<void()> handler) {
         deny();
-        handler_ = std::move(handler);
-        timer = rxcpp::observable<>::timer(std::chrono::milliseconds(millis));
-        handle = timer.subscribe_on(rxcpp::observe_on_new_thread())
-                     .subscribe([this](auto) { handler_(); });
+        handle_ = wheel_->schedule(std::chrono::milliseconds(millis),
+                                   std::move(handler));
       }
 
-      void TimerImpl::deny() { handle.unsubscribe(); }
+      void TimerImpl::deny() { handle_.cancel(); }
 
-      TimerImpl::~TimerImpl() { deny(); }
+      TimerImpl::~TimerImpl() {
+        // handler may be running on the wheel thread
+        wheel_->cancelAndWait(handle_);
+      }
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
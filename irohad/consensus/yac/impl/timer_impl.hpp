@@ -18,15 +18,20 @@
 #ifndef IROHA_TIMER_IMPL_HPP
 #define IROHA_TIMER_IMPL_HPP
 
+#include <memory>
+
 #include "consensus/yac/timer.hpp"
-#include <rxcpp/rx.hpp>
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
       class TimerImpl : public Timer {
        public:
-        TimerImpl() = default;
+        /**
+         * @param wheel - shared timer wheel which executes handlers
+         */
+        explicit TimerImpl(std::shared_ptr<TimerWheel> wheel);
         TimerImpl(const TimerImpl&) = delete;
         TimerImpl& operator=(const TimerImpl&) = delete;
 
@@ -37,10 +42,8 @@ namespace iroha {
         ~TimerImpl() override;
 
        private:
-        std::function<void()> handler_;
-
-        rxcpp::observable<long> timer;
-        rxcpp::composite_subscription handle;
+        std::shared_ptr<TimerWheel> wheel_;
+        TimerWheel::Handle handle_;
       };
     }  // namespace yac
   }    // namespace consensus
@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <utility>
 
 #include "consensus/yac/yac.hpp"
@@ -49,9 +50,15 @@ namespace iroha {
           std::shared_ptr<YacCryptoProvider> crypto,
           std::shared_ptr<Timer> timer,
           ClusterOrdering order,
-          uint64_t delay) {
-        return std::make_shared<Yac>(
-            vote_storage, network, crypto, timer, order, delay);
+          uint64_t delay,
+          Dissemination dissemination) {
+        return std::make_shared<Yac>(vote_storage,
+                                     network,
+                                     crypto,
+                                     timer,
+                                     order,
+                                     delay,
+                                     dissemination);
       }
 
       Yac::Yac(YacVoteStorage vote_storage,
@@ -59,13 +66,15 @@ namespace iroha {
                std::shared_ptr<YacCryptoProvider> crypto,
                std::shared_ptr<Timer> timer,
                ClusterOrdering order,
-               uint64_t delay)
+               uint64_t delay,
+               Dissemination dissemination)
           : vote_storage_(std::move(vote_storage)),
             network_(std::move(network)),
             crypto_(std::move(crypto)),
             timer_(std::move(timer)),
             cluster_order_(order),
-            delay_(delay) {
+            delay_(delay),
+            dissemination_(dissemination) {
         log_ = logger::log("YAC");
       }
 
@@ -76,8 +85,13 @@ namespace iroha {
                    logger::to_string(order.getPeers(),
                                      [](auto val) { return val.address; }));
 
-        cluster_order_ = order;
         auto vote = crypto_->getVote(hash);
+        {
+          std::lock_guard<std::mutex> guard(mutex_);
+          cluster_order_ = order;
+          self_ = vote.signature.pubkey;
+          round_hash_ = hash.proposal_hash;
+        }
         votingStep(vote);
       }
 
@@ -87,9 +101,12 @@ namespace iroha {
 
       // ------|Network notifications|------
 
+      // Verification does not touch round state, so messages are verified
+      // before taking the lock and network threads check them concurrently
+
       void Yac::on_vote(VoteMessage vote) {
-        std::lock_guard<std::mutex> guard(mutex_);
         if (crypto_->verify(vote)) {
+          std::lock_guard<std::mutex> guard(mutex_);
           applyVote(findPeer(vote), vote);
         } else {
           log_->warn(cryptoError({vote}));
@@ -97,8 +114,8 @@ namespace iroha {
       }
 
       void Yac::on_commit(CommitMessage commit) {
-        std::lock_guard<std::mutex> guard(mutex_);
         if (crypto_->verify(commit)) {
+          std::lock_guard<std::mutex> guard(mutex_);
           // Commit does not contain data about peer which sent the message
           applyCommit(nonstd::nullopt, commit);
         } else {
@@ -107,8 +124,8 @@ namespace iroha {
       }
 
       void Yac::on_reject(RejectMessage reject) {
-        std::lock_guard<std::mutex> guard(mutex_);
         if (crypto_->verify(reject)) {
+          std::lock_guard<std::mutex> guard(mutex_);
           // Reject does not contain data about peer which sent the message
           applyReject(nonstd::nullopt, reject);
         } else {
@@ -119,18 +136,26 @@ namespace iroha {
       // ------|Private interface|------
 
       void Yac::votingStep(VoteMessage vote) {
-        auto committed = vote_storage_.isHashCommitted(vote.hash.proposal_hash);
-        if (committed) {
-          return;
+        model::Peer leader;
+        bool has_next;
+        {
+          // round state is shared with network threads, vote is sent
+          // without the lock since network may deliver it synchronously
+          std::lock_guard<std::mutex> guard(mutex_);
+          if (vote_storage_.isHashCommitted(vote.hash.proposal_hash)) {
+            return;
+          }
+          leader = cluster_order_.currentLeader();
+          cluster_order_.switchToNext();
+          has_next = cluster_order_.hasNext();
         }
 
         log_->info("Vote for hash ({}, {})",
-                   vote.hash.proposal_hash,
-                   vote.hash.block_hash);
+                   vote.hash.proposal_hash.to_hexstring(),
+                   vote.hash.block_hash.to_hexstring());
 
-        network_->send_vote(cluster_order_.currentLeader(), vote);
-        cluster_order_.switchToNext();
-        if (cluster_order_.hasNext()) {
+        network_->send_vote(leader, vote);
+        if (has_next) {
           timer_->invokeAfterDelay(delay_,
                                    [this, vote] { this->votingStep(vote); });
         }
@@ -160,6 +185,10 @@ namespace iroha {
 
           if (not already_processed) {
             answer.commit | [&](const auto &commit) {
+              // relay before notification, which may start the next round
+              for (const auto &peer : this->relayTargets(proposal_hash)) {
+                this->propagateCommitDirectly(peer, commit);
+              }
               notifier_.get_subscriber().on_next(commit);
             };
             answer.reject | [&](const auto &reject) {
@@ -175,6 +204,16 @@ namespace iroha {
       void Yac::applyReject(nonstd::optional<model::Peer> from,
                             RejectMessage reject) {
         // TODO 01/08/17 Muratov: apply to vote storage IR-497
+        // votes of reject are for different blocks, so it is relayed once
+        // per proposal without vote storage
+        if (dissemination_.fanout != 0 and not reject.votes.empty()
+            and reject.votes.front().hash.proposal_hash
+                != last_relayed_reject_) {
+          last_relayed_reject_ = reject.votes.front().hash.proposal_hash;
+          for (const auto &peer : relayTargets(last_relayed_reject_)) {
+            propagateRejectDirectly(peer, reject);
+          }
+        }
         closeRound();
       }
 
@@ -182,11 +221,11 @@ namespace iroha {
                           VoteMessage vote) {
         if (from.has_value()) {
           log_->info("Apply vote: {} from ledger peer {}",
-                     vote.hash.block_hash,
+                     vote.hash.block_hash.to_hexstring(),
                      from.value().address);
         } else {
           log_->info("Apply vote: {} from unknown peer {}",
-                     vote.hash.block_hash,
+                     vote.hash.block_hash.to_hexstring(),
                      vote.signature.pubkey.to_hexstring());
         }
 
@@ -203,12 +242,13 @@ namespace iroha {
               // propagate for all
 
               log_->info("Propagate commit {} to whole network",
-                         vote.hash.block_hash);
+                         vote.hash.block_hash.to_hexstring());
 
               this->propagateCommit(commit);
             };
             answer.reject | [&](const auto &reject) {
-              log_->info("Reject case on hash {} achieved", proposal_hash);
+              log_->info("Reject case on hash {} achieved",
+                         proposal_hash.to_hexstring());
 
               // propagate reject for all
               this->propagateReject(reject);
@@ -219,13 +259,14 @@ namespace iroha {
                 // propagate directly
 
                 log_->info("Propagate commit {} directly to {}",
-                           vote.hash.block_hash,
+                           vote.hash.block_hash.to_hexstring(),
                            from.address);
 
                 this->propagateCommitDirectly(from, commit);
               };
               answer.reject | [&](const auto &reject) {
-                log_->info("Reject case on hash {} achieved", proposal_hash);
+                log_->info("Reject case on hash {} achieved",
+                           proposal_hash.to_hexstring());
 
                 // propagate directly
                 this->propagateRejectDirectly(from, reject);
@@ -238,7 +279,7 @@ namespace iroha {
       // ------|Propagation|------
 
       void Yac::propagateCommit(CommitMessage msg) {
-        for (const auto &peer : cluster_order_.getPeers()) {
+        for (const auto &peer : disseminationTargets(false)) {
           propagateCommitDirectly(peer, msg);
         }
       }
@@ -248,7 +289,7 @@ namespace iroha {
       }
 
       void Yac::propagateReject(RejectMessage msg) {
-        for (const auto &peer : cluster_order_.getPeers()) {
+        for (const auto &peer : disseminationTargets(false)) {
           propagateRejectDirectly(peer, msg);
         }
       }
@@ -257,6 +298,46 @@ namespace iroha {
         network_->send_reject(std::move(to), std::move(msg));
       }
 
+      std::vector<model::Peer> Yac::disseminationTargets(bool relay) {
+        auto peers = cluster_order_.getPeers();
+        auto fanout = dissemination_.fanout;
+        if (fanout == 0) {
+          return relay ? std::vector<model::Peer>{} : peers;
+        }
+
+        // peer at position p relays to positions fanout * (p + 1) + i,
+        // the committing peer is the virtual root of positions [0, fanout)
+        size_t first = 0;
+        if (relay) {
+          auto self = std::find_if(
+              peers.begin(), peers.end(), [this](const auto &peer) {
+                return self_ and peer.pubkey == *self_;
+              });
+          if (self == peers.end()) {
+            // order of the round is unknown yet, peers missed by the tree
+            // receive commit in reply to their votes
+            return {};
+          }
+          first = fanout * (std::distance(peers.begin(), self) + 1);
+        }
+        if (first >= peers.size()) {
+          return {};
+        }
+        auto last = std::min(peers.size(), first + fanout);
+        return std::vector<model::Peer>(peers.begin() + first,
+                                        peers.begin() + last);
+      }
+
+      std::vector<model::Peer> Yac::relayTargets(
+          const ProposalHash &proposal_hash) {
+        if (proposal_hash != round_hash_) {
+          // stored order belongs to another round, its tree positions
+          // are meaningless for the message
+          return {};
+        }
+        return disseminationTargets(true);
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
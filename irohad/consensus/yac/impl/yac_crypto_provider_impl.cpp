@@ -16,6 +16,12 @@
  */
 
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#include <tbb/parallel_for.h>
+
 #include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "crypto/crypto.hpp"
 #include "crypto/hash.hpp"
@@ -23,43 +29,85 @@
 namespace iroha {
   namespace consensus {
     namespace yac {
+
+      namespace {
+        /**
+         * Hash of payload signed by vote for the given hash
+         */
+        std::string votePayloadHash(const YacHash &hash) {
+          VoteMessage vote;
+          vote.hash = hash;
+          auto payload =
+              PbConverters::serializeVote(vote).hash().SerializeAsString();
+          return iroha::sha3_256(payload).to_string();
+        }
+      }  // namespace
+
+      constexpr size_t CryptoProviderImpl::PARALLEL_BATCH;
       CryptoProviderImpl::CryptoProviderImpl(const keypair_t &keypair)
-          : keypair_(keypair) {}
+          : signer_(keypair) {}
 
       bool CryptoProviderImpl::verify(CommitMessage msg) {
-        return std::all_of(
-            std::begin(msg.votes),
-            std::end(msg.votes),
-            [this](const auto &vote) { return this->verify(vote); });
+        return verifyVotes(msg.votes);
       }
 
       bool CryptoProviderImpl::verify(RejectMessage msg) {
-        return std::all_of(
-            std::begin(msg.votes),
-            std::end(msg.votes),
-            [this](const auto &vote) { return this->verify(vote); });
+        return verifyVotes(msg.votes);
+      }
+
+      bool CryptoProviderImpl::verifyVotes(
+          const std::vector<VoteMessage> &votes) {
+        // votes of a bundle usually sign the same hash,
+        // so each distinct payload is hashed once
+        std::vector<std::pair<const YacHash *, std::string>> payloads;
+        std::vector<size_t> payload_of(votes.size());
+        for (size_t i = 0; i < votes.size(); ++i) {
+          const auto &hash = votes[i].hash;
+          auto it = std::find_if(
+              payloads.begin(), payloads.end(), [&hash](const auto &payload) {
+                return *payload.first == hash
+                    and payload.first->block_signature == hash.block_signature;
+              });
+          if (it == payloads.end()) {
+            it = payloads.emplace(
+                payloads.end(), &hash, votePayloadHash(hash));
+          }
+          payload_of[i] = it - payloads.begin();
+        }
+
+        std::atomic<bool> valid{true};
+        auto verify_range = [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end and valid; ++i) {
+            if (not iroha::verify(payloads[payload_of[i]].second,
+                                  votes[i].signature.pubkey,
+                                  votes[i].signature.signature)) {
+              valid = false;
+            }
+          }
+        };
+        if (votes.size() < PARALLEL_BATCH) {
+          verify_range(0, votes.size());
+        } else {
+          tbb::parallel_for(
+              tbb::blocked_range<size_t>(0, votes.size()),
+              [&verify_range](const tbb::blocked_range<size_t> &r) {
+                verify_range(r.begin(), r.end());
+              });
+        }
+        return valid;
       }
 
       bool CryptoProviderImpl::verify(VoteMessage msg) {
-        return iroha::verify(
-            iroha::sha3_256(
-                PbConverters::serializeVote(msg).hash().SerializeAsString())
-                .to_string(),
-            msg.signature.pubkey,
-            msg.signature.signature);
+        return iroha::verify(votePayloadHash(msg.hash),
+                             msg.signature.pubkey,
+                             msg.signature.signature);
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
         VoteMessage vote;
         vote.hash = hash;
-        auto signature = iroha::sign(
-            iroha::sha3_256(
-                PbConverters::serializeVote(vote).hash().SerializeAsString())
-                .to_string(),
-            keypair_.pubkey,
-            keypair_.privkey);
-        vote.signature.signature = signature;
-        vote.signature.pubkey = keypair_.pubkey;
+        vote.signature.signature = signer_.sign(votePayloadHash(hash));
+        vote.signature.pubkey = signer_.publicKey();
         return vote;
       }
 
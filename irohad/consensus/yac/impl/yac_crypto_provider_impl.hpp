@@ -18,7 +18,10 @@
 #ifndef IROHA_YAC_CRYPTO_PROVIDER_IMPL_HPP
 #define IROHA_YAC_CRYPTO_PROVIDER_IMPL_HPP
 
+#include <vector>
+
 #include "consensus/yac/yac_crypto_provider.hpp"
+#include "crypto/signer.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -36,7 +39,20 @@ namespace iroha {
         VoteMessage getVote(YacHash hash) override;
 
        private:
-        keypair_t keypair_;
+        /**
+         * Verify all votes, each distinct payload is hashed once and
+         * signatures of large bundles are checked in parallel
+         * @param votes - votes to verify
+         * @return true if every signature is valid
+         */
+        bool verifyVotes(const std::vector<VoteMessage> &votes);
+
+        /**
+         * Bundles smaller than this are verified in the calling thread
+         */
+        static constexpr size_t PARALLEL_BATCH = 4;
+
+        Signer signer_;
       };
     }  // namespace yac
   }    // namespace consensus
@@ -16,7 +16,7 @@
  */
 
 #include "consensus/yac/impl/yac_hash_provider_impl.hpp"
-#include "common/byteutils.hpp"
+#include "crypto/hash.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -24,18 +24,25 @@ namespace iroha {
 
       YacHash YacHashProviderImpl::makeHash(const model::Block &block) const {
         YacHash result;
-        // TODO 01/08/17 Muratov: add proposal hash to block, block.proposal_hash IR-505
-        auto hex_hash = block.hash.to_hexstring();
-        result.proposal_hash = hex_hash;
-        result.block_hash = hex_hash;
+        result.proposal_hash = proposalHash(block);
+        result.block_hash = block.hash;
         result.block_signature = block.sigs.front();
         return result;
       }
 
       model::Block::HashType YacHashProviderImpl::toModelHash(
           const YacHash &hash) const {
-        return hexstringToArray<model::Block::HashType::size()>(hash.block_hash)
-            .value();
+        return hash.block_hash;
+      }
+
+      YacHash::HashType YacHashProviderImpl::proposalHash(
+          const model::Block &block) {
+        std::string payload(sizeof(block.height), 0);
+        for (size_t i = 0; i < sizeof(block.height); ++i) {
+          payload[i] = (block.height >> (8 * i)) & 0xFF;
+        }
+        payload += block.prev_hash.to_string();
+        return sha3_256(payload);
       }
     }  // namespace yac
   }    // namespace consensus
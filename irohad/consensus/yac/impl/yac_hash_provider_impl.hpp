@@ -28,6 +28,16 @@ namespace iroha {
         YacHash makeHash(const model::Block &block) const override;
 
         model::Block::HashType toModelHash(const YacHash &hash) const override;
+
+        /**
+         * Hash of the proposal which the block is built from. Proposal is
+         * issued once per height on top of the ledger, so it is identified
+         * by height and previous block, and peers with different blocks for
+         * the same proposal vote in the same round
+         * @param block - block of the round
+         * @return proposal hash
+         */
+        static YacHash::HashType proposalHash(const model::Block &block);
       };
     }  // namespace yac
   }    // namespace consensus
@@ -37,10 +37,12 @@ namespace iroha {
 
       nonstd::optional<Answer> YacBlockStorage::insert(VoteMessage msg) {
         if (validScheme(msg) and uniqueVote(msg)) {
+          voters_.insert(msg.signature.pubkey.to_string());
           votes_.push_back(msg);
 
-          log_->info("Vote ({}, {}) inserted", msg.hash.proposal_hash,
-                     msg.hash.block_hash);
+          log_->info("Vote ({}, {}) inserted",
+                     msg.hash.proposal_hash.to_hexstring(),
+                     msg.hash.block_hash.to_hexstring());
           log_->info("Votes in storage [{}/{}]", votes_.size(),
                      peers_in_round_);
         }
@@ -70,7 +72,7 @@ namespace iroha {
     }
 
     bool YacBlockStorage::isContains(const VoteMessage &msg) const {
-      return std::count(votes_.begin(), votes_.end(), msg) != 0;
+      return validScheme(msg) and not uniqueVote(msg);
     }
 
     YacHash YacBlockStorage::getStorageHash() {
@@ -79,15 +81,12 @@ namespace iroha {
 
     // --------| private api |--------
 
-    bool YacBlockStorage::uniqueVote(VoteMessage &msg) {
-      // lookup take O(n) times
-      return std::all_of(votes_.begin(), votes_.end(), [&msg](auto vote) {
-        return vote != msg;
-      });
+    bool YacBlockStorage::uniqueVote(const VoteMessage &msg) const {
+      return voters_.count(msg.signature.pubkey.to_string()) == 0;
     }
 
-    bool YacBlockStorage::validScheme(VoteMessage &vote) {
-      return getStorageHash() == vote.hash;
+    bool YacBlockStorage::validScheme(const VoteMessage &vote) const {
+      return hash_ == vote.hash;
     }
 
     } // namespace yac
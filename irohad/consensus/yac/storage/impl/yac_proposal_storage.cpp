@@ -16,7 +16,6 @@
  */
 
 #include <algorithm>
-#include <numeric>
 #include "consensus/yac/storage/yac_common.hpp"
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 
@@ -29,24 +28,18 @@ namespace iroha {
 
       // --------| private api |--------
 
-      auto YacProposalStorage::findStore(ProposalHash proposal_hash,
-                                         BlockHash block_hash) {
-
+      YacBlockStorage &YacProposalStorage::findStore(
+          const ProposalHash &proposal_hash, const BlockHash &block_hash) {
         // find exist
-        auto iter =
-            std::find_if(block_storages_.begin(), block_storages_.end(),
-                         [&proposal_hash, &block_hash](auto block_storage) {
-                           auto yac_hash = block_storage.getStorageHash();
-                           return yac_hash.proposal_hash == proposal_hash and
-                               yac_hash.block_hash == block_hash;
-                         });
-        if (iter != block_storages_.end()) {
-          return iter;
+        auto iter = block_index_.find(block_hash);
+        if (iter != block_index_.end()) {
+          return block_storages_.at(iter->second);
         }
         // insert and return new
-        return block_storages_
-            .emplace(block_storages_.end(),
-                     YacHash(proposal_hash, block_hash), peers_in_round_);
+        block_index_.emplace(block_hash, block_storages_.size());
+        block_storages_.emplace_back(YacHash(proposal_hash, block_hash),
+                                     peers_in_round_);
+        return block_storages_.back();
       }
 
       // --------| public api |--------
@@ -64,11 +57,12 @@ namespace iroha {
           // insert to block store
 
           log_->info("Vote [{}, {}] looks valid",
-                     msg.hash.proposal_hash,
-                     msg.hash.block_hash);
+                     msg.hash.proposal_hash.to_hexstring(),
+                     msg.hash.block_hash.to_hexstring());
 
-          auto iter = findStore(msg.hash.proposal_hash, msg.hash.block_hash);
-          auto block_state = iter->insert(msg);
+          voters_.insert(msg.signature.pubkey.to_string());
+          auto &store = findStore(msg.hash.proposal_hash, msg.hash.block_hash);
+          auto block_state = store.insert(msg);
 
           if (block_state.has_value() and
               block_state->commit.has_value()) {
@@ -114,13 +108,7 @@ namespace iroha {
       }
 
       bool YacProposalStorage::checkPeerUniqueness(const VoteMessage &msg) {
-        return std::all_of(block_storages_.begin(), block_storages_.end(),
-                           [&msg](YacBlockStorage &storage) {
-                             if (storage.getStorageHash() != msg.hash) {
-                               return true;
-                             }
-                             return not storage.isContains(msg);
-                           });
+        return voters_.count(msg.signature.pubkey.to_string()) == 0;
       }
 
       nonstd::optional<Answer> YacProposalStorage::findRejectProof() {
@@ -131,11 +119,7 @@ namespace iroha {
                                    right.getNumberOfVotes();
                              })->getNumberOfVotes();
 
-        auto all_votes =
-            std::accumulate(block_storages_.begin(), block_storages_.end(),
-                            0ull, [](auto &acc, auto &storage) {
-                  return acc + storage.getNumberOfVotes();
-                });
+        auto all_votes = voters_.size();
 
         auto is_reject = hasReject(max_vote, all_votes, peers_in_round_);
 
@@ -24,32 +24,50 @@ namespace iroha {
   namespace consensus {
     namespace yac {
 
+      constexpr size_t YacVoteStorage::DEFAULT_WINDOW;
+
       // --------| private api |--------
 
-      auto YacVoteStorage::getProposalStorage(ProposalHash hash) {
-        return std::find_if(proposal_storages_.begin(),
-                            proposal_storages_.end(),
-                            [&hash](auto storage) {
-                              return storage.getProposalHash() == hash;
-                            });
+      YacProposalStorage *YacVoteStorage::getProposalStorage(
+          const ProposalHash &hash) {
+        auto iter = rounds_.find(hash);
+        if (iter == rounds_.end()) {
+          return nullptr;
+        }
+        return &iter->second.storage;
       }
 
-      auto YacVoteStorage::findProposalStorage(const VoteMessage &msg,
-                                               uint64_t peers_in_round) {
+      YacProposalStorage &YacVoteStorage::findProposalStorage(
+          const VoteMessage &msg, uint64_t peers_in_round) {
         auto val = getProposalStorage(msg.hash.proposal_hash);
-        if (val != proposal_storages_.end()) {
-          return val;
+        if (val != nullptr) {
+          return *val;
         }
-        return proposal_storages_
-            .emplace(proposal_storages_.end(),
-                     msg.hash.proposal_hash, peers_in_round);
+        // evict before insertion, so new round is never evicted at once
+        collectGarbage();
+        order_.push_back(msg.hash.proposal_hash);
+        return rounds_
+            .emplace(msg.hash.proposal_hash,
+                     Round{next_round_++,
+                           YacProposalStorage(msg.hash.proposal_hash,
+                                              peers_in_round),
+                           false})
+            .first->second.storage;
       }
 
       // --------| public api |--------
 
+      YacVoteStorage::YacVoteStorage(size_t window)
+          : window_(std::max<size_t>(window, 1)) {}
+
       nonstd::optional<Answer> YacVoteStorage::store(VoteMessage vote,
                                                      uint64_t peers_in_round) {
-        return findProposalStorage(vote, peers_in_round)->insert(vote);
+        if (isEvicted(vote.hash.proposal_hash)) {
+          return nonstd::nullopt;
+        }
+        return updateDecided(
+            vote.hash.proposal_hash,
+            findProposalStorage(vote, peers_in_round).insert(vote));
       }
 
       nonstd::optional<Answer> YacVoteStorage::store(CommitMessage commit,
@@ -63,19 +81,30 @@ namespace iroha {
       }
 
       bool YacVoteStorage::isHashCommitted(ProposalHash hash) {
-        auto iter = getProposalStorage(std::move(hash));
-        if (iter == proposal_storages_.end()) {
+        auto storage = getProposalStorage(hash);
+        if (storage == nullptr) {
           return false;
         }
-        return iter->getState().has_value();
+        return storage->getState().has_value();
       }
 
       bool YacVoteStorage::getProcessingState(const ProposalHash &hash) {
-        return processing_state_.count(hash) != 0;
+        auto iter = rounds_.find(hash);
+        if (iter == rounds_.end()) {
+          return isEvicted(hash);
+        }
+        return iter->second.processed;
       }
 
       void YacVoteStorage::markAsProcessedState(const ProposalHash &hash) {
-        processing_state_.insert(hash);
+        auto iter = rounds_.find(hash);
+        if (iter != rounds_.end()) {
+          iter->second.processed = true;
+        }
+      }
+
+      size_t YacVoteStorage::getNumberOfRounds() const {
+        return rounds_.size();
       }
 
       // --------| private api |--------
@@ -83,12 +112,46 @@ namespace iroha {
       nonstd::optional<Answer>
       YacVoteStorage::insert_votes(std::vector<VoteMessage> &votes,
                                    uint64_t peers_in_round) {
-        if (not sameProposals(votes)) {
+        if (not sameProposals(votes)
+            or isEvicted(votes.at(0).hash.proposal_hash)) {
           return nonstd::nullopt;
         }
 
-        auto storage = findProposalStorage(votes.at(0), peers_in_round);
-        return storage->insert(votes);
+        auto &storage = findProposalStorage(votes.at(0), peers_in_round);
+        return updateDecided(votes.at(0).hash.proposal_hash,
+                             storage.insert(votes));
+      }
+
+      nonstd::optional<Answer> YacVoteStorage::updateDecided(
+          const ProposalHash &hash, nonstd::optional<Answer> answer) {
+        if (answer.has_value()) {
+          last_decided_ = std::max(last_decided_, rounds_.at(hash).number);
+        }
+        return answer;
+      }
+
+      void YacVoteStorage::collectGarbage() {
+        while (order_.size() >= window_) {
+          auto iter = rounds_.find(order_.front());
+          auto outdated = iter->second.number <= last_decided_;
+          if (not outdated and order_.size() < 2 * window_) {
+            break;
+          }
+          if (iter->second.processed) {
+            evicted_.insert(iter->first);
+            evicted_order_.push_back(iter->first);
+          }
+          rounds_.erase(iter);
+          order_.pop_front();
+        }
+        while (evicted_order_.size() > 2 * window_) {
+          evicted_.erase(evicted_order_.front());
+          evicted_order_.pop_front();
+        }
+      }
+
+      bool YacVoteStorage::isEvicted(const ProposalHash &hash) const {
+        return evicted_.count(hash) != 0;
       }
 
     } // namespace yac
@@ -18,6 +18,7 @@
 #ifndef IROHA_YAC_BLOCK_VOTE_STORAGE_HPP
 #define IROHA_YAC_BLOCK_VOTE_STORAGE_HPP
 
+#include <unordered_set>
 #include <vector>
 #include <nonstd/optional.hpp>
 #include "consensus/yac/storage/storage_result.hpp"
@@ -41,6 +42,11 @@ namespace iroha {
          */
         std::vector<VoteMessage> votes_;
 
+        /**
+         * Public keys of peers voted in storage, for constant time lookup
+         */
+        std::unordered_set<std::string> voters_;
+
        public:
 
         YacBlockStorage(YacHash hash, uint64_t peers_in_round);
@@ -96,14 +102,14 @@ namespace iroha {
          * @param msg - vote for verification
          * @return true if vote doesn't appear in storage
          */
-        bool uniqueVote(VoteMessage &vote);
+        bool uniqueVote(const VoteMessage &vote) const;
 
         /**
          * Verify that vote has same proposal and
          * blocks hashes with storage
          * @return true, if validation passed
          */
-        bool validScheme(VoteMessage &vote);
+        bool validScheme(const VoteMessage &vote) const;
 
         // --------| fields |--------
 
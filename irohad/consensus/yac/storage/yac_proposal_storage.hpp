@@ -20,6 +20,7 @@
 
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <nonstd/optional.hpp>
 
 #include "consensus/yac/messages.hpp"
@@ -42,13 +43,14 @@ namespace iroha {
         // --------| private api |--------
 
         /**
-         * Find block index with provided parameters,
+         * Find block storage with provided parameters,
          * if those store absent - create new
          * @param proposal_hash - hash of proposal
          * @param block_hash - hash of block
-         * @return iterator to storage
+         * @return reference to storage
          */
-        auto findStore(ProposalHash proposal_hash, BlockHash block_hash);
+        YacBlockStorage &findStore(const ProposalHash &proposal_hash,
+                                   const BlockHash &block_hash);
 
        public:
         // --------| public api |--------
@@ -100,7 +102,8 @@ namespace iroha {
         bool checkProposalHash(ProposalHash vote_hash);
 
         /**
-         * Is this peer first time appear in this proposal storage
+         * Is this peer first time appear in this proposal storage.
+         * Each peer has one vote per proposal, whichever block it votes for
          * @return true, if peer unique
          */
         bool checkPeerUniqueness(const VoteMessage &msg);
@@ -127,6 +130,16 @@ namespace iroha {
          */
         std::vector<YacBlockStorage> block_storages_;
 
+        /**
+         * Position of block storage in block_storages_ by block hash
+         */
+        std::unordered_map<BlockHash, size_t> block_index_;
+
+        /**
+         * Public keys of peers voted for any block of this proposal
+         */
+        std::unordered_set<std::string> voters_;
+
         /**
          * Hash of proposal
          */
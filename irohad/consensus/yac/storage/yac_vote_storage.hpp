@@ -18,6 +18,8 @@
 #ifndef IROHA_YAC_VOTE_STORAGE_HPP
 #define IROHA_YAC_VOTE_STORAGE_HPP
 
+#include <deque>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <nonstd/optional.hpp>
@@ -34,6 +36,14 @@ namespace iroha {
 
       /**
        * Class provide storage for votes and useful methods for it.
+       *
+       * Votes are grouped in rounds, one round per proposal hash, numbered
+       * in order of appearance. Only the last window of rounds is kept:
+       * older rounds are evicted as soon as a round not older than them is
+       * committed or rejected, and undecided ones are evicted after one more
+       * window, so storage holds at most twice the window of rounds.
+       * Hashes of processed rounds are remembered for two more windows after
+       * eviction, so late messages do not bring them back.
        */
       class YacVoteStorage {
 
@@ -41,11 +51,11 @@ namespace iroha {
         // --------| private api |--------
 
         /**
-         * Retrieve iterator for storage with parameters hash
+         * Retrieve proposal storage with parameters hash
          * @param hash - object for finding
-         * @return iterator to proposal storage
+         * @return pointer to proposal storage, nullptr if absent
          */
-        auto getProposalStorage(ProposalHash hash);
+        YacProposalStorage *getProposalStorage(const ProposalHash &hash);
 
         /**
          * Find existed proposal storage or create new if required
@@ -53,19 +63,25 @@ namespace iroha {
          * @param peers_in_round - number of peer required
          * for verify supermajority;
          * This parameter used on creation of proposal storage
-         * @return - iter for required proposal storage
+         * @return - reference to required proposal storage
          */
-        auto findProposalStorage(const VoteMessage &msg,
-                                 uint64_t peers_in_round);
+        YacProposalStorage &findProposalStorage(const VoteMessage &msg,
+                                                uint64_t peers_in_round);
 
        public:
         // --------| public api |--------
 
+        /**
+         * @param window - number of latest rounds kept in storage
+         */
+        explicit YacVoteStorage(size_t window = DEFAULT_WINDOW);
+
         /**
          * Insert vote in storage
          * @param msg - current vote message
          * @param peers_in_round - number of peers participated in round
-         * @return structure with result of inserting. Nullopt if mgs not valid.
+         * @return structure with result of inserting. Nullopt if mgs not valid
+         * or its round is processed and evicted.
          */
         nonstd::optional<Answer> store(VoteMessage msg,
                                        uint64_t peers_in_round);
@@ -75,7 +91,7 @@ namespace iroha {
          * @param commit - message with votes
          * @param peers_in_round - number of peers in current consensus round
          * @return structure with result of inserting.
-         * Nullopt if commit not valid.
+         * Nullopt if commit not valid or its round is processed and evicted.
          */
         nonstd::optional<Answer> store(CommitMessage commit,
                                        uint64_t peers_in_round);
@@ -85,7 +101,7 @@ namespace iroha {
          * @param reject - message with votes
          * @param peers_in_round - number of peers in current consensus round
          * @return structure with result of inserting.
-         * Nullopt if reject not valid.
+         * Nullopt if reject not valid or its round is processed and evicted.
          */
         nonstd::optional<Answer> store(RejectMessage reject,
                                        uint64_t peers_in_round);
@@ -100,7 +116,8 @@ namespace iroha {
         /**
          * Method provide state of processing for concrete hash
          * @param hash - target tag
-         * @return value attached to parameter's hash. Default is false.
+         * @return value attached to parameter's hash, true for processed
+         * rounds which are evicted. Default is false.
          */
         bool getProcessingState(const ProposalHash &hash);
 
@@ -110,6 +127,13 @@ namespace iroha {
          */
         void markAsProcessedState(const ProposalHash &hash);
 
+        /**
+         * @return number of rounds kept in storage
+         */
+        size_t getNumberOfRounds() const;
+
+        static constexpr size_t DEFAULT_WINDOW = 16;
+
        private:
         // --------| private api |--------
 
@@ -122,18 +146,76 @@ namespace iroha {
         nonstd::optional<Answer> insert_votes(std::vector<VoteMessage> &votes,
                                               uint64_t peers_in_round);
 
+        /**
+         * Remember round of proposal storage if it is decided
+         * @param hash - proposal hash of round
+         * @param answer - state of storage
+         * @return passed answer
+         */
+        nonstd::optional<Answer> updateDecided(
+            const ProposalHash &hash, nonstd::optional<Answer> answer);
+
+        /**
+         * Evict rounds which are out of the window
+         */
+        void collectGarbage();
+
+        /**
+         * Check whether round is processed and evicted already
+         * @param hash - proposal hash of round
+         * @return true if messages of the round are outdated
+         */
+        bool isEvicted(const ProposalHash &hash) const;
+
+        /**
+         * Votes of one proposal with its position in sequence of rounds
+         */
+        struct Round {
+          uint64_t number;
+          YacProposalStorage storage;
+
+          /**
+           * Processing flag provided by user
+           */
+          bool processed;
+        };
+
         // --------| fields |--------
 
         /**
-         * Active proposal storages
+         * Number of latest rounds kept in storage
+         */
+        size_t window_;
+
+        /**
+         * Active rounds by proposal hash
+         */
+        std::unordered_map<ProposalHash, Round> rounds_;
+
+        /**
+         * Proposal hashes of active rounds, oldest first
+         */
+        std::deque<ProposalHash> order_;
+
+        /**
+         * Proposal hashes of processed rounds which are evicted
+         */
+        std::unordered_set<ProposalHash> evicted_;
+
+        /**
+         * Evicted proposal hashes, oldest first
+         */
+        std::deque<ProposalHash> evicted_order_;
+
+        /**
+         * Number of the next created round
          */
-        std::vector<YacProposalStorage> proposal_storages_;
+        uint64_t next_round_{1};
 
         /**
-         * Processing set provide user flags about processing some hashes.
-         * If hash exists <=> processed
+         * Number of the latest committed or rejected round, 0 if none
          */
-        std::unordered_set<ProposalHash> processing_state_;
+        uint64_t last_decided_{0};
       };
 
     } // namespace yac
@@ -27,45 +27,44 @@ namespace iroha {
     namespace yac {
       // ----------| Public API |----------
 
-      NetworkImpl::NetworkImpl() {
+      NetworkImpl::NetworkImpl(std::shared_ptr<YacPeerOrderer> orderer)
+          : orderer_(std::move(orderer)),
+            thread_(&NetworkImpl::asyncCompleteRpc, this) {
         log_ = logger::log("YacNetwork");
       }
 
+      NetworkImpl::~NetworkImpl() {
+        {
+          std::lock_guard<std::mutex> lock(peers_mutex_);
+          for (auto &peer : peers_) {
+            peer.second->close();
+          }
+        }
+        cq_.Shutdown();
+        if (thread_.joinable()) {
+          thread_.join();
+        }
+      }
+
       void NetworkImpl::subscribe(
           std::shared_ptr<YacNetworkNotifications> handler) {
         handler_ = handler;
       }
 
       void NetworkImpl::send_vote(model::Peer to, VoteMessage vote) {
-        createPeerConnection(to);
-
-        auto request = PbConverters::serializeVote(vote);
+        auto frame = pool_.acquire();
+        *frame->mutable_vote() = PbConverters::serializeVote(vote);
+        streamTo(to).send(std::move(frame));
 
-        auto call = new AsyncClientCall;
-
-        call->response_reader =
-            peers_.at(to)->AsyncSendVote(&call->context, request, &cq_);
-
-        call->response_reader->Finish(&call->reply, &call->status, call);
-
-        log_->info("Send vote {} to {}", vote.hash.block_hash, to.address);
+        log_->info("Send vote {} to {}",
+                   vote.hash.block_hash.to_hexstring(),
+                   to.address);
       }
 
       void NetworkImpl::send_commit(model::Peer to, CommitMessage commit) {
-        createPeerConnection(to);
-
-        proto::Commit request;
-        for (const auto &vote : commit.votes) {
-          auto pb_vote = request.add_votes();
-          *pb_vote = PbConverters::serializeVote(vote);
-        }
-
-        auto call = new AsyncClientCall;
-
-        call->response_reader =
-            peers_.at(to)->AsyncSendCommit(&call->context, request, &cq_);
-
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        auto frame = pool_.acquire();
+        serializeBundle(commit.votes, *frame->mutable_commit());
+        streamTo(to).send(std::move(frame));
 
         log_->info("Send votes bundle[size={}] commit to {}",
                    commit.votes.size(),
@@ -73,20 +72,9 @@ namespace iroha {
       }
 
       void NetworkImpl::send_reject(model::Peer to, RejectMessage reject) {
-        createPeerConnection(to);
-
-        proto::Reject request;
-        for (const auto &vote : reject.votes) {
-          auto pb_vote = request.add_votes();
-          *pb_vote = PbConverters::serializeVote(vote);
-        }
-
-        auto call = new AsyncClientCall;
-
-        call->response_reader =
-            peers_.at(to)->AsyncSendReject(&call->context, request, &cq_);
-
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        auto frame = pool_.acquire();
+        serializeBundle(reject.votes, *frame->mutable_reject());
+        streamTo(to).send(std::move(frame));
 
         log_->info("Send votes bundle[size={}] reject to {}",
                    reject.votes.size(),
@@ -97,12 +85,18 @@ namespace iroha {
           ::grpc::ServerContext *context,
           const ::iroha::consensus::yac::proto::Vote *request,
           ::google::protobuf::Empty *response) {
-        auto vote = *PbConverters::deserializeVote(*request);
+        auto vote = PbConverters::deserializeVote(*request);
+        if (not vote) {
+          log_->warn("Malformed vote from {}", context->peer());
+          return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                              "malformed vote");
+        }
 
-        log_->info(
-            "Receive vote {} from {}", vote.hash.block_hash, context->peer());
+        log_->info("Receive vote {} from {}",
+                   vote->hash.block_hash.to_hexstring(),
+                   context->peer());
 
-        handler_.lock()->on_vote(vote);
+        handler_.lock()->on_vote(*vote);
         return grpc::Status::OK;
       }
 
@@ -110,11 +104,13 @@ namespace iroha {
           ::grpc::ServerContext *context,
           const ::iroha::consensus::yac::proto::Commit *request,
           ::google::protobuf::Empty *response) {
-        CommitMessage commit;
-        for (const auto &pb_vote : request->votes()) {
-          auto vote = *PbConverters::deserializeVote(pb_vote);
-          commit.votes.push_back(vote);
+        auto votes = deserializeBundle(*request);
+        if (not votes) {
+          log_->warn("Malformed commit from {}", context->peer());
+          return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                              "malformed certificate");
         }
+        CommitMessage commit(std::move(*votes));
 
         log_->info("Receive commit[size={}] from {}",
                    commit.votes.size(),
@@ -128,11 +124,13 @@ namespace iroha {
           ::grpc::ServerContext *context,
           const ::iroha::consensus::yac::proto::Reject *request,
           ::google::protobuf::Empty *response) {
-        RejectMessage reject;
-        for (const auto &pb_vote : request->votes()) {
-          auto vote = *PbConverters::deserializeVote(pb_vote);
-          reject.votes.push_back(vote);
+        auto votes = deserializeBundle(*request);
+        if (not votes) {
+          log_->warn("Malformed reject from {}", context->peer());
+          return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                              "malformed certificate");
         }
+        RejectMessage reject(std::move(*votes));
 
         log_->info("Receive reject[size={}] from {}",
                    reject.votes.size(),
@@ -142,11 +140,93 @@ namespace iroha {
         return grpc::Status::OK;
       }
 
-      void NetworkImpl::createPeerConnection(const model::Peer &peer) {
-        if (peers_.count(peer) == 0) {
-          peers_[peer] = proto::Yac::NewStub(grpc::CreateChannel(
-              peer.address, grpc::InsecureChannelCredentials()));
+      grpc::Status NetworkImpl::Stream(
+          ::grpc::ServerContext *context,
+          ::grpc::ServerReader<::iroha::consensus::yac::proto::Frame> *reader,
+          ::google::protobuf::Empty *response) {
+        log_->info("Open stream from {}", context->peer());
+        proto::Frame frame;
+        google::protobuf::Empty empty;
+        while (reader->Read(&frame)) {
+          switch (frame.message_case()) {
+            case proto::Frame::kVote:
+              SendVote(context, &frame.vote(), &empty);
+              break;
+            case proto::Frame::kCommit:
+              SendCommit(context, &frame.commit(), &empty);
+              break;
+            case proto::Frame::kReject:
+              SendReject(context, &frame.reject(), &empty);
+              break;
+            default:
+              log_->warn("Empty frame from {}", context->peer());
+              break;
+          }
+        }
+        log_->info("Close stream from {}", context->peer());
+        return grpc::Status::OK;
+      }
+
+      PeerStream &NetworkImpl::streamTo(const model::Peer &peer) {
+        std::lock_guard<std::mutex> lock(peers_mutex_);
+        auto &stream = peers_[peer];
+        if (not stream) {
+          stream = std::make_unique<PeerStream>(
+              proto::Yac::NewStub(grpc::CreateChannel(
+                  peer.address, grpc::InsecureChannelCredentials())),
+              cq_,
+              pool_);
+        }
+        return *stream;
+      }
+
+      void NetworkImpl::asyncCompleteRpc() {
+        void *got_tag;
+        auto ok = false;
+        while (cq_.Next(&got_tag, &ok)) {
+          PeerStream::handle(got_tag, ok);
+        }
+      }
+
+      std::vector<model::Peer> NetworkImpl::orderFor(const YacHash &hash) {
+        if (not orderer_) {
+          return {};
+        }
+        std::lock_guard<std::mutex> lock(order_mutex_);
+        if (last_order_.first != hash.proposal_hash) {
+          auto order = orderer_->getOrdering(hash);
+          if (not order) {
+            return {};
+          }
+          last_order_ = {hash.proposal_hash, order->getPeers()};
+        }
+        return last_order_.second;
+      }
+
+      template <typename Bundle>
+      void NetworkImpl::serializeBundle(const std::vector<VoteMessage> &votes,
+                                        Bundle &bundle) {
+        PbConverters::serializeBundle(
+            votes,
+            votes.empty() ? std::vector<model::Peer>{}
+                          : orderFor(votes.front().hash),
+            bundle);
+      }
+
+      template <typename Bundle>
+      nonstd::optional<std::vector<VoteMessage>>
+      NetworkImpl::deserializeBundle(const Bundle &bundle) {
+        // all votes of a bundle are for the same proposal
+        std::vector<model::Peer> order;
+        if (bundle.certificates_size() != 0) {
+          auto hash =
+              PbConverters::deserializeHash(bundle.certificates(0).hash());
+          if (not hash) {
+            return nonstd::nullopt;
+          }
+          order = orderFor(*hash);
         }
+        return PbConverters::deserializeBundle(bundle, order);
       }
 
     }  // namespace yac
@@ -19,13 +19,16 @@
 #define IROHA_NETWORK_IMPL_HPP
 
 #include <atomic>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "ametsuchi/peer_query.hpp"
+#include "consensus/yac/transport/impl/peer_stream.hpp"
 #include "consensus/yac/transport/yac_network_interface.hpp"
+#include "consensus/yac/yac_peer_orderer.hpp"
 #include "logger/logger.hpp"
-#include "network/impl/async_grpc_client.hpp"
 #include "yac.grpc.pb.h"
 
 namespace iroha {
@@ -33,14 +36,20 @@ namespace iroha {
     namespace yac {
 
       /**
-       * Class provide implementation of transport for consensus based on grpc
+       * Class provide implementation of transport for consensus based on grpc.
+       * Messages to a peer are written to a long-lived stream of the peer
        */
-      class NetworkImpl : public YacNetwork,
-                          public proto::Yac::Service,
-                          network::AsyncGrpcClient<google::protobuf::Empty> {
+      class NetworkImpl : public YacNetwork, public proto::Yac::Service {
        public:
 
-        NetworkImpl();
+        /**
+         * @param orderer - provider of cluster ordering for proposal,
+         * commits and rejects are sent as compact certificates over it.
+         * Votes are sent in full if it is nullptr
+         */
+        explicit NetworkImpl(std::shared_ptr<YacPeerOrderer> orderer = nullptr);
+        ~NetworkImpl() override;
+
         void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) override;
         void send_commit(model::Peer to, CommitMessage commit) override;
@@ -77,20 +86,72 @@ namespace iroha {
             const ::iroha::consensus::yac::proto::Reject *request,
             ::google::protobuf::Empty *response) override;
 
+        /**
+         * Receive stream of messages from another peer
+         */
+        grpc::Status Stream(
+            ::grpc::ServerContext *context,
+            ::grpc::ServerReader<::iroha::consensus::yac::proto::Frame>
+                *reader,
+            ::google::protobuf::Empty *response) override;
+
        private:
 
         /**
-         * Create GRPC connection for given peer if it does not exist in
-         * peers map
+         * Get stream to the peer, create it if it does not exist
          * @param peer to instantiate connection with
+         * @return stream of the peer
+         */
+        PeerStream &streamTo(const model::Peer &peer);
+
+        /**
+         * Complete operations of peer streams
+         */
+        void asyncCompleteRpc();
+
+        /**
+         * Cluster ordering of the proposal, same on sender and receiver
+         * @param hash - hash with proposal of the round
+         * @return peers in order, empty if ordering is not available
+         */
+        std::vector<model::Peer> orderFor(const YacHash &hash);
+
+        /**
+         * Pack bundle of votes for sending
          */
-        void createPeerConnection(const model::Peer &peer);
+        template <typename Bundle>
+        void serializeBundle(const std::vector<VoteMessage> &votes,
+                             Bundle &bundle);
 
         /**
-         * Mapping of peer objects to connections
+         * Unpack received bundle of votes
+         * @return votes, nullopt if bundle is malformed
          */
-        std::unordered_map<model::Peer, std::unique_ptr<proto::Yac::Stub>>
-            peers_;
+        template <typename Bundle>
+        nonstd::optional<std::vector<VoteMessage>> deserializeBundle(
+            const Bundle &bundle);
+
+        std::shared_ptr<YacPeerOrderer> orderer_;
+
+        /**
+         * Ordering of the last requested proposal, since the same order
+         * is used for every recipient and bundle of a round
+         */
+        std::pair<nonstd::optional<YacHash::HashType>,
+                  std::vector<model::Peer>>
+            last_order_;
+        std::mutex order_mutex_;
+
+        FramePool pool_;
+
+        /**
+         * Mapping of peer objects to streams
+         */
+        std::unordered_map<model::Peer, std::unique_ptr<PeerStream>> peers_;
+        std::mutex peers_mutex_;
+
+        grpc::CompletionQueue cq_;
+        std::thread thread_;
 
         /**
          * Subscriber of network messages
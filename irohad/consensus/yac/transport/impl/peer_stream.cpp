@@ -0,0 +1,201 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "consensus/yac/transport/impl/peer_stream.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      constexpr size_t FramePool::DEFAULT_CAPACITY;
+      constexpr size_t PeerStream::MAX_PENDING;
+      constexpr std::chrono::milliseconds PeerStream::MIN_REOPEN_DELAY;
+      constexpr std::chrono::milliseconds PeerStream::MAX_REOPEN_DELAY;
+
+      // ----------| FramePool |----------
+
+      FramePool::FramePool(size_t capacity) : capacity_(capacity) {
+        frames_.reserve(capacity_);
+      }
+
+      std::unique_ptr<proto::Frame> FramePool::acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (frames_.empty()) {
+          return std::make_unique<proto::Frame>();
+        }
+        auto frame = std::move(frames_.back());
+        frames_.pop_back();
+        return frame;
+      }
+
+      void FramePool::release(std::unique_ptr<proto::Frame> frame) {
+        if (not frame) {
+          return;
+        }
+        frame->Clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (frames_.size() < capacity_) {
+          frames_.push_back(std::move(frame));
+        }
+      }
+
+      // ----------| PeerStream |----------
+
+      PeerStream::PeerStream(std::unique_ptr<proto::Yac::Stub> stub,
+                             grpc::CompletionQueue &cq,
+                             FramePool &pool)
+          : stub_(std::move(stub)), cq_(cq), pool_(pool) {}
+
+      void PeerStream::send(std::unique_ptr<proto::Frame> frame) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) {
+          pool_.release(std::move(frame));
+          return;
+        }
+        if (pending_.size() >= MAX_PENDING) {
+          pool_.release(std::move(pending_.front()));
+          pending_.pop_front();
+        }
+        pending_.push_back(std::move(frame));
+        switch (state_) {
+          case State::CLOSED:
+            scheduleOpen();
+            break;
+          case State::IDLE:
+            writeNext();
+            break;
+          default:
+            // frame is written after current operation
+            break;
+        }
+      }
+
+      void PeerStream::close() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        closed_ = true;
+        if (context_) {
+          context_->TryCancel();
+        }
+        if (state_ == State::IDLE) {
+          finish();
+        }
+        if (state_ == State::WAITING) {
+          alarm_->Cancel();
+        }
+        closed_cv_.wait(lock, [this] { return state_ == State::CLOSED; });
+      }
+
+      void PeerStream::handle(void *tag, bool ok) {
+        auto event = static_cast<Event *>(tag);
+        event->stream->onEvent(event->state, ok);
+      }
+
+      void PeerStream::onEvent(State state, bool ok) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        switch (state) {
+          case State::OPENING:
+          case State::WRITING:
+            pool_.release(std::move(in_flight_));
+            if (not ok and state == State::OPENING and not pending_.empty()) {
+              pool_.release(std::move(pending_.front()));
+              pending_.pop_front();
+            }
+            if (not ok or closed_) {
+              finish();
+              return;
+            }
+            if (state == State::OPENING) {
+              reopen_delay_ = MIN_REOPEN_DELAY;
+            }
+            state_ = State::IDLE;
+            writeNext();
+            break;
+          case State::FINISHING:
+            writer_.reset();
+            context_.reset();
+            if (not closed_) {
+              // stream failed, the peer may be down, so the next open
+              // is delayed to keep frames sent meanwhile from spinning
+              reopen_after_ = std::chrono::system_clock::now() + reopen_delay_;
+              reopen_delay_ = std::min(reopen_delay_ * 2, MAX_REOPEN_DELAY);
+            }
+            reopen();
+            break;
+          case State::WAITING:
+            // fired or cancelled by close
+            alarm_.reset();
+            reopen();
+            break;
+          default:
+            break;
+        }
+      }
+
+      void PeerStream::open() {
+        context_ = std::make_unique<grpc::ClientContext>();
+        writer_ = stub_->AsyncStream(
+            context_.get(), &response_, &cq_, &open_event_);
+        state_ = State::OPENING;
+      }
+
+      void PeerStream::writeNext() {
+        if (pending_.empty()) {
+          return;
+        }
+        in_flight_ = std::move(pending_.front());
+        pending_.pop_front();
+        writer_->Write(*in_flight_, &write_event_);
+        state_ = State::WRITING;
+      }
+
+      void PeerStream::finish() {
+        writer_->Finish(&status_, &finish_event_);
+        state_ = State::FINISHING;
+      }
+
+      void PeerStream::reopen() {
+        state_ = State::CLOSED;
+        if (closed_) {
+          drop();
+        } else if (not pending_.empty()) {
+          scheduleOpen();
+        }
+        closed_cv_.notify_all();
+      }
+
+      void PeerStream::scheduleOpen() {
+        if (std::chrono::system_clock::now() >= reopen_after_) {
+          open();
+          return;
+        }
+        alarm_ = std::make_unique<grpc::Alarm>(
+            &cq_, reopen_after_, &reopen_event_);
+        state_ = State::WAITING;
+      }
+
+      void PeerStream::drop() {
+        for (auto &frame : pending_) {
+          pool_.release(std::move(frame));
+        }
+        pending_.clear();
+      }
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
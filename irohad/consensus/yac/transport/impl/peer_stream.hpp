@@ -0,0 +1,188 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_PEER_STREAM_HPP
+#define IROHA_PEER_STREAM_HPP
+
+#include <google/protobuf/empty.pb.h>
+#include <grpc++/alarm.h>
+#include <grpc++/grpc++.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "yac.grpc.pb.h"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /**
+       * Pool of consensus frames, keeps released frames for reuse
+       * instead of allocating a frame per message
+       */
+      class FramePool {
+       public:
+        /**
+         * @param capacity - maximal number of kept frames
+         */
+        explicit FramePool(size_t capacity = DEFAULT_CAPACITY);
+
+        /**
+         * @return empty frame
+         */
+        std::unique_ptr<proto::Frame> acquire();
+
+        /**
+         * Return frame to the pool
+         * @param frame - frame which is no longer used
+         */
+        void release(std::unique_ptr<proto::Frame> frame);
+
+        static constexpr size_t DEFAULT_CAPACITY = 64;
+
+       private:
+        const size_t capacity_;
+        std::vector<std::unique_ptr<proto::Frame>> frames_;
+        std::mutex mutex_;
+      };
+
+      /**
+       * Long-lived client stream of consensus frames to one peer.
+       * Frames are written one at a time in order of sending. Operations
+       * complete on the given completion queue, tags of which must be
+       * passed to handle(). On failure the frame being written is lost,
+       * and the stream is not reopened for new or pending frames until a
+       * delay passes, which doubles with every failure until the stream is
+       * opened. Failed opening costs the oldest pending frame, so an
+       * unreachable peer is not retried forever
+       */
+      class PeerStream {
+       public:
+        /**
+         * @param stub - connection to the peer
+         * @param cq - queue for completion of stream operations
+         * @param pool - pool for written frames
+         */
+        PeerStream(std::unique_ptr<proto::Yac::Stub> stub,
+                   grpc::CompletionQueue &cq,
+                   FramePool &pool);
+
+        /**
+         * Enqueue frame for writing, open stream if it is closed
+         * @param frame - frame to send
+         */
+        void send(std::unique_ptr<proto::Frame> frame);
+
+        /**
+         * Cancel the stream and stop reopening it. Blocks until pending
+         * operations are completed, so the queue must still be served
+         */
+        void close();
+
+        /**
+         * Handle completed operation of a stream
+         * @param tag - tag of the operation from the completion queue
+         * @param ok - status of the operation
+         */
+        static void handle(void *tag, bool ok);
+
+        /**
+         * Maximal number of frames waiting for writing, the oldest frames
+         * are dropped when the peer does not keep up
+         */
+        static constexpr size_t MAX_PENDING = 256;
+
+        /**
+         * Bounds of the delay before reopening failed stream
+         */
+        static constexpr std::chrono::milliseconds MIN_REOPEN_DELAY{10};
+        static constexpr std::chrono::milliseconds MAX_REOPEN_DELAY{1000};
+
+       private:
+        enum class State {
+          CLOSED,
+          OPENING,
+          IDLE,
+          WRITING,
+          FINISHING,
+          WAITING
+        };
+
+        /**
+         * Tag of an operation in the completion queue
+         */
+        struct Event {
+          PeerStream *stream;
+          State state;
+        };
+
+        void onEvent(State state, bool ok);
+        void open();
+        void writeNext();
+        void finish();
+        void drop();
+
+        /**
+         * Move to closed state and reopen the stream for pending frames
+         * unless it is closed
+         */
+        void reopen();
+
+        /**
+         * Open the stream now, or wait on the completion queue until the
+         * delay after last failure expires
+         */
+        void scheduleOpen();
+
+        std::unique_ptr<proto::Yac::Stub> stub_;
+        grpc::CompletionQueue &cq_;
+        FramePool &pool_;
+
+        std::unique_ptr<grpc::ClientContext> context_;
+        std::unique_ptr<grpc::ClientAsyncWriter<proto::Frame>> writer_;
+        google::protobuf::Empty response_;
+        grpc::Status status_;
+
+        Event open_event_{this, State::OPENING};
+        Event write_event_{this, State::WRITING};
+        Event finish_event_{this, State::FINISHING};
+        Event reopen_event_{this, State::WAITING};
+
+        /**
+         * Delays reopening after failure, fires on the completion queue
+         */
+        std::unique_ptr<grpc::Alarm> alarm_;
+        std::chrono::milliseconds reopen_delay_ = MIN_REOPEN_DELAY;
+        std::chrono::system_clock::time_point reopen_after_;
+
+        State state_ = State::CLOSED;
+        bool closed_ = false;
+        std::unique_ptr<proto::Frame> in_flight_;
+        std::deque<std::unique_ptr<proto::Frame>> pending_;
+        std::mutex mutex_;
+        std::condition_variable closed_cv_;
+      };
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_PEER_STREAM_HPP
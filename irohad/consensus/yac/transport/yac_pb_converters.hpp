@@ -18,8 +18,13 @@
 #ifndef IROHA_YAC_PB_CONVERTERS_HPP
 #define IROHA_YAC_PB_CONVERTERS_HPP
 
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 #include "common/byteutils.hpp"
 #include "consensus/yac/messages.hpp"
+#include "model/peer.hpp"
 #include "yac.pb.h"
 
 namespace iroha {
@@ -27,18 +32,44 @@ namespace iroha {
     namespace yac {
       class PbConverters {
        public:
+        static proto::Hash serializeHash(const YacHash &hash) {
+          proto::Hash pb_hash;
+          pb_hash.set_block(hash.block_hash.to_string());
+          pb_hash.set_proposal(hash.proposal_hash.to_string());
+
+          auto block_signature = pb_hash.mutable_block_signature();
+          block_signature->set_signature(
+              hash.block_signature.signature.to_string());
+          block_signature->set_pubkey(hash.block_signature.pubkey.to_string());
+
+          return pb_hash;
+        }
+
+        /**
+         * @return hash, nullopt if some field has wrong size
+         */
+        static nonstd::optional<YacHash> deserializeHash(
+            const proto::Hash &pb_hash) {
+          using HashType = YacHash::HashType;
+          auto proposal = stringToBlob<HashType::size()>(pb_hash.proposal());
+          auto block = stringToBlob<HashType::size()>(pb_hash.block());
+          auto signature = stringToBlob<iroha::sig_t::size()>(
+              pb_hash.block_signature().signature());
+          auto pubkey = stringToBlob<iroha::pubkey_t::size()>(
+              pb_hash.block_signature().pubkey());
+          if (not proposal or not block or not signature or not pubkey) {
+            return nonstd::nullopt;
+          }
+          YacHash hash(*proposal, *block);
+          hash.block_signature.signature = *signature;
+          hash.block_signature.pubkey = *pubkey;
+          return hash;
+        }
+
         static proto::Vote serializeVote(const VoteMessage &vote) {
           proto::Vote pb_vote;
 
-          auto hash = pb_vote.mutable_hash();
-          hash->set_block(vote.hash.block_hash);
-          hash->set_proposal(vote.hash.proposal_hash);
-
-          auto block_signature = hash->mutable_block_signature();
-          block_signature->set_signature(
-              vote.hash.block_signature.signature.to_string());
-          block_signature->set_pubkey(
-              vote.hash.block_signature.pubkey.to_string());
+          *pb_vote.mutable_hash() = serializeHash(vote.hash);
 
           auto signature = pb_vote.mutable_signature();
           signature->set_signature(vote.signature.signature.to_string());
@@ -47,24 +78,139 @@ namespace iroha {
           return pb_vote;
         }
 
+        /**
+         * @return vote, nullopt if some field has wrong size
+         */
         static nonstd::optional<VoteMessage> deserializeVote(
             const proto::Vote &pb_vote) {
-          VoteMessage vote;
-          vote.hash.proposal_hash = pb_vote.hash().proposal();
-          vote.hash.block_hash = pb_vote.hash().block();
-          vote.hash.block_signature.signature =
-              *stringToBlob<iroha::sig_t::size()>(
-                  pb_vote.hash().block_signature().signature());
-          vote.hash.block_signature.pubkey =
-              *stringToBlob<iroha::pubkey_t::size()>(
-                  pb_vote.hash().block_signature().pubkey());
-          vote.signature.signature = *stringToBlob<iroha::sig_t::size()>(
+          auto hash = deserializeHash(pb_vote.hash());
+          auto signature = stringToBlob<iroha::sig_t::size()>(
               pb_vote.signature().signature());
-          vote.signature.pubkey = *stringToBlob<iroha::pubkey_t::size()>(
+          auto pubkey = stringToBlob<iroha::pubkey_t::size()>(
               pb_vote.signature().pubkey());
+          if (not hash or not signature or not pubkey) {
+            return nonstd::nullopt;
+          }
 
+          VoteMessage vote;
+          vote.hash = *hash;
+          vote.signature.signature = *signature;
+          vote.signature.pubkey = *pubkey;
           return vote;
         }
+
+        /**
+         * Pack votes into bundle: votes of peers present in order are
+         * grouped by hash into certificates, other votes are kept in full
+         * @tparam Bundle - proto::Commit or proto::Reject
+         * @param votes - votes for packing
+         * @param order - cluster ordering of the proposal, may be empty
+         * @param bundle - message to fill
+         */
+        template <typename Bundle>
+        static void serializeBundle(const std::vector<VoteMessage> &votes,
+                                    const std::vector<model::Peer> &order,
+                                    Bundle &bundle) {
+          std::unordered_map<std::string, size_t> positions;
+          for (size_t i = 0; i < order.size(); ++i) {
+            positions.emplace(order[i].pubkey.to_string(), i);
+          }
+
+          // votes of one hash by position of signer in order
+          using Group = std::pair<const YacHash *,
+                                  std::vector<const VoteMessage *>>;
+          std::vector<Group> groups;
+          for (const auto &vote : votes) {
+            auto position = positions.find(vote.signature.pubkey.to_string());
+            if (position == positions.end()) {
+              *bundle.add_votes() = serializeVote(vote);
+              continue;
+            }
+            auto group = std::find_if(
+                groups.begin(), groups.end(), [&vote](const auto &group) {
+                  return *group.first == vote.hash
+                      and group.first->block_signature
+                      == vote.hash.block_signature;
+                });
+            if (group == groups.end()) {
+              group = groups.emplace(
+                  groups.end(),
+                  &vote.hash,
+                  std::vector<const VoteMessage *>(order.size()));
+            }
+            group->second[position->second] = &vote;
+          }
+
+          for (const auto &group : groups) {
+            auto certificate = bundle.add_certificates();
+            *certificate->mutable_hash() = serializeHash(*group.first);
+            std::string signers((order.size() + 7) / 8, 0);
+            for (size_t i = 0; i < order.size(); ++i) {
+              if (group.second[i] == nullptr) {
+                continue;
+              }
+              signers[i / 8] |= 1 << (i % 8);
+              certificate->add_signatures(
+                  group.second[i]->signature.signature.to_string());
+            }
+            certificate->set_signers(signers);
+          }
+        }
+
+        /**
+         * Unpack votes from bundle
+         * @tparam Bundle - proto::Commit or proto::Reject
+         * @param bundle - message to read
+         * @param order - cluster ordering of the proposal used by sender
+         * @return votes, nullopt if some vote is malformed or certificate
+         * does not match order
+         */
+        template <typename Bundle>
+        static nonstd::optional<std::vector<VoteMessage>> deserializeBundle(
+            const Bundle &bundle, const std::vector<model::Peer> &order) {
+          std::vector<VoteMessage> votes;
+          for (const auto &pb_vote : bundle.votes()) {
+            auto vote = deserializeVote(pb_vote);
+            if (not vote) {
+              return nonstd::nullopt;
+            }
+            votes.push_back(*vote);
+          }
+
+          for (const auto &certificate : bundle.certificates()) {
+            const auto &signers = certificate.signers();
+            if (signers.size() > (order.size() + 7) / 8) {
+              return nonstd::nullopt;
+            }
+            auto hash = deserializeHash(certificate.hash());
+            if (not hash) {
+              return nonstd::nullopt;
+            }
+            VoteMessage vote;
+            vote.hash = *hash;
+            int next = 0;
+            for (size_t i = 0; i < signers.size() * 8; ++i) {
+              if (((signers[i / 8] >> (i % 8)) & 1) == 0) {
+                continue;
+              }
+              if (i >= order.size() or next >= certificate.signatures_size()) {
+                return nonstd::nullopt;
+              }
+              auto signature = stringToBlob<iroha::sig_t::size()>(
+                  certificate.signatures(next++));
+              if (not signature) {
+                return nonstd::nullopt;
+              }
+              vote.signature.pubkey = order[i].pubkey;
+              vote.signature.signature = *signature;
+              votes.push_back(vote);
+            }
+            if (next != certificate.signatures_size()) {
+              return nonstd::nullopt;
+            }
+          }
+          return votes;
+        }
       };
     }  // namespace yac
   }    // namespace consensus
@@ -36,12 +36,26 @@
 namespace iroha {
   namespace consensus {
     namespace yac {
+      /**
+       * Way of spreading commits and rejects over cluster
+       */
+      struct Dissemination {
+        /**
+         * Number of peers each peer sends a message to. Peers of cluster
+         * ordering form a tree with this arity: the committing peer sends to
+         * the first fanout peers and each peer relays to its children once.
+         * With 0 the committing peer sends to every peer directly
+         */
+        size_t fanout = 0;
+      };
+
       class Yac : public HashGate,
                   public YacNetworkNotifications {
        public:
         /**
          * Method for creating Yac consensus object
          * @param delay for timer in milliseconds
+         * @param dissemination - way of spreading commits and rejects
          */
         static std::shared_ptr<Yac> create(
             YacVoteStorage vote_storage,
@@ -49,14 +63,16 @@ namespace iroha {
             std::shared_ptr<YacCryptoProvider> crypto,
             std::shared_ptr<Timer> timer,
             ClusterOrdering order,
-            uint64_t delay);
+            uint64_t delay,
+            Dissemination dissemination = Dissemination());
 
         Yac(YacVoteStorage vote_storage,
             std::shared_ptr<YacNetwork> network,
             std::shared_ptr<YacCryptoProvider> crypto,
             std::shared_ptr<Timer> timer,
             ClusterOrdering order,
-            uint64_t delay);
+            uint64_t delay,
+            Dissemination dissemination = Dissemination());
 
         // ------|Hash gate|------
 
@@ -113,6 +129,24 @@ namespace iroha {
         void propagateReject(RejectMessage msg);
         void propagateRejectDirectly(model::Peer to, RejectMessage msg);
 
+        /**
+         * Peers to send a message to in tree dissemination
+         * @param relay - false for the committing peer, true for a peer
+         * relaying received message
+         * @return first peers of ordering for the committing peer,
+         * children of this peer for relaying one
+         */
+        std::vector<model::Peer> disseminationTargets(bool relay);
+
+        /**
+         * Peers to relay a received message of given proposal to
+         * @param proposal_hash - proposal of the received message
+         * @return children of this peer if the message belongs to the round
+         * of stored ordering, empty otherwise
+         */
+        std::vector<model::Peer> relayTargets(
+            const ProposalHash &proposal_hash);
+
         // ------|Fields|------
         YacVoteStorage vote_storage_;
         std::shared_ptr<YacNetwork> network_;
@@ -124,8 +158,24 @@ namespace iroha {
         // ------|One round|------
         ClusterOrdering cluster_order_;
 
+        /**
+         * Public key of this peer, known since its first vote
+         */
+        nonstd::optional<pubkey_t> self_;
+
+        /**
+         * Proposal hash of the round which stored ordering belongs to
+         */
+        ProposalHash round_hash_;
+
+        /**
+         * Proposal hash of the last reject relayed by this peer
+         */
+        ProposalHash last_relayed_reject_;
+
         // ------|Constants|------
         const uint64_t delay_;
+        const Dissemination dissemination_;
 
         // ------|Logger|------
         logger::Logger log_;
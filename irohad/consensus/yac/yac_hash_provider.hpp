@@ -31,22 +31,25 @@ namespace iroha {
 
       class YacHash {
        public:
-        YacHash(std::string proposal, std::string block)
-            : proposal_hash(std::move(proposal)),
-              block_hash(std::move(block)) {
-        }
+        /**
+         * Fixed-size binary hash, used as key of consensus storages
+         */
+        using HashType = hash256_t;
+
+        YacHash(HashType proposal, HashType block)
+            : proposal_hash(proposal), block_hash(block) {}
 
         YacHash() = default;
 
         /**
          * Hash computed from proposal
          */
-        std::string proposal_hash;
+        HashType proposal_hash;
 
         /**
          * Hash computed from block;
          */
-        std::string block_hash;
+        HashType block_hash;
 
         /**
          * Peer signature of block
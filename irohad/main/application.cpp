@@ -36,8 +36,15 @@ Irohad::Irohad(const std::string &block_store_dir,
                size_t internal_port,
                size_t max_proposal_size,
                std::chrono::milliseconds proposal_delay,
+               size_t max_queue_size,
+               const std::vector<ordering::LaneConfig> &ordering_lanes,
+               const std::string &ordering_wal_path,
+               bool compact_proposals,
                std::chrono::milliseconds vote_delay,
                std::chrono::milliseconds load_delay,
+               size_t vote_fanout,
+               size_t validation_workers,
+               size_t ordering_partitions,
                const keypair_t &keypair)
     : block_store_dir_(block_store_dir),
       redis_host_(redis_host),
@@ -47,8 +54,15 @@ Irohad::Irohad(const std::string &block_store_dir,
       internal_port_(internal_port),
       max_proposal_size_(max_proposal_size),
       proposal_delay_(proposal_delay),
+      max_queue_size_(max_queue_size),
+      ordering_lanes_(ordering_lanes),
+      ordering_wal_path_(ordering_wal_path),
+      compact_proposals_(compact_proposals),
       vote_delay_(vote_delay),
       load_delay_(load_delay),
+      vote_fanout_(vote_fanout),
+      validation_workers_(validation_workers),
+      ordering_partitions_(ordering_partitions),
       keypair(keypair) {
   log_ = logger::log("IROHAD");
   log_->info("created");
@@ -57,7 +71,10 @@ Irohad::Irohad(const std::string &block_store_dir,
 
 Irohad::~Irohad() {
   if (internal_server) {
-    internal_server->Shutdown();
+    // consensus streams of peers are never complete, they are cancelled
+    // after the deadline
+    internal_server->Shutdown(std::chrono::system_clock::now()
+                              + std::chrono::seconds(1));
   }
   if (torii_server) {
     torii_server->shutdown();
@@ -119,25 +136,53 @@ void Irohad::initCryptoProvider() {
 void Irohad::initValidators() {
   stateless_validator =
       std::make_shared<StatelessValidatorImpl>(crypto_verifier);
-  stateful_validator = std::make_shared<StatefulValidatorImpl>();
-  chain_validator = std::make_shared<ChainValidatorImpl>();
+  // every worker holds its own postgres connection
+  auto validation_workers = validation_workers_ != 0
+      ? validation_workers_
+      : std::min<size_t>(std::thread::hardware_concurrency(), 8);
+  stateful_validator =
+      std::make_shared<StatefulValidatorImpl>(storage, validation_workers);
+  chain_validator = std::make_shared<ChainValidatorImpl>(crypto_verifier);
 
   log_->info("[Init] => validators");
 }
 
 void Irohad::initOrderingGate() {
-  ordering_gate =
-      ordering_init.initOrderingGate(wsv, max_proposal_size_, proposal_delay_);
+  // proposal generation queries ledger and publishes proposals, so it must
+  // not delay consensus timers
+  ordering_timer_wheel = std::make_shared<iroha::TimerWheel>();
+  // ingress of ordering service is served by grpc threads, one partition
+  // per core keeps them from contending on one queue
+  auto ordering_partitions = ordering_partitions_ != 0
+      ? ordering_partitions_
+      : std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), 8);
+  ordering_gate = ordering_init.initOrderingGate(wsv,
+                                                 max_proposal_size_,
+                                                 proposal_delay_,
+                                                 max_queue_size_,
+                                                 ordering_partitions,
+                                                 ordering_lanes_,
+                                                 ordering_wal_path_,
+                                                 storage->getBlockQuery(),
+                                                 compact_proposals_,
+                                                 ordering_timer_wheel);
   log_->info("[Init] => init ordering gate - [{}]",
              logger::logBool(ordering_gate));
 }
 
 void Irohad::initSimulator() {
+  // few blocks may be voted at once, keep a window of them
+  write_sets = std::make_shared<ametsuchi::WriteSetCache>(4);
   simulator = std::make_shared<Simulator>(ordering_gate,
                                           stateful_validator,
                                           storage,
                                           storage->getBlockQuery(),
-                                          crypto_verifier);
+                                          crypto_verifier,
+                                          write_sets);
+  // validation time of proposals tunes their size
+  simulator->on_verified_proposal().subscribe([this](auto proposal) {
+    ordering_init.ordering_service->onProposalValidated(proposal.height);
+  });
 
   log_->info("[Init] => init simulator");
 }
@@ -150,20 +195,41 @@ void Irohad::initBlockLoader() {
 }
 
 void Irohad::initConsensusGate() {
+  timer_wheel = std::make_shared<iroha::TimerWheel>();
   consensus_gate =
       yac_init.initConsensusGate(wsv,
                                  simulator,
                                  block_loader,
                                  keypair,
                                  vote_delay_,
-                                 load_delay_);
+                                 load_delay_,
+                                 vote_fanout_,
+                                 timer_wheel);
 
   log_->info("[Init] => consensus gate");
 }
 
 void Irohad::initSynchronizer() {
   synchronizer = std::make_shared<SynchronizerImpl>(
-      consensus_gate, chain_validator, storage, block_loader);
+      consensus_gate, chain_validator, storage, block_loader, write_sets);
+  // after the ledger is updated, simulator may pass proposal
+  // validated on top of the committed block
+  storage->getBlockQuery()->getTopBlocks(1).as_blocking().subscribe(
+      [this](auto block) { ordering_committed_height = block.height; });
+  synchronizer->on_commit_chain().subscribe([this](auto) {
+    simulator->process_commit();
+    // commit latency of proposals tunes the delay between them, committed
+    // transactions are remembered by dedup filter. Downloaded chain is
+    // committed at once, its blocks are read from the ledger, since the
+    // chain itself is downloaded again on subscription
+    storage->getBlockQuery()
+        ->getBlocksFrom(ordering_committed_height + 1)
+        .as_blocking()
+        .subscribe([this](auto block) {
+          ordering_init.ordering_service->onCommit(block);
+          ordering_committed_height = block.height;
+        });
+  });
 
   log_->info("[Init] => synchronizer");
 }
@@ -186,7 +252,7 @@ void Irohad::initTransactionCommandService() {
       std::make_shared<TransactionProcessorImpl>(pcs, stateless_validator);
 
   command_service = std::make_unique<::torii::CommandService>(
-      pb_tx_factory, tx_processor, storage);
+      pb_tx_factory, tx_processor, storage, ordering_gate);
 
   log_->info("[Init] => command service");
 }
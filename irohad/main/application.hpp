@@ -33,6 +33,7 @@
 #include "simulator/block_creator.hpp"
 #include "simulator/impl/simulator.hpp"
 #include "synchronizer/synchronizer.hpp"
+#include "timer/timer_wheel.hpp"
 #include "torii/command_service.hpp"
 #include "torii/processor/query_processor_impl.hpp"
 #include "torii/processor/transaction_processor_impl.hpp"
@@ -60,9 +61,24 @@ class Irohad {
    * @param max_proposal_size - maximum transactions that possible appears in
    * one proposal
    * @param proposal_delay - maximum waiting time util emitting new proposal
+   * @param max_queue_size - high-water mark of ordering queue, torii rejects
+   * transactions for a short backoff after it is reached
+   * @param ordering_lanes - weighted lanes of ordering queue for
+   * latency-sensitive accounts and domains
+   * @param ordering_wal_path - directory of write-ahead log of ordering queue,
+   * empty to keep the queue in memory only
+   * @param compact_proposals - send proposals as transaction hashes, peers
+   * fetch bodies they have not seen from ordering service
    * @param vote_delay - waiting time before sending vote to next peer
    * @param load_delay - waiting time before loading committed block from next
    * peer
+   * @param vote_fanout - arity of tree spreading commits over peers,
+   * 0 to send them to every peer directly
+   * @param validation_workers - maximal number of workers validating
+   * independent transactions of proposal, each one holds its own database
+   * connection, 0 to choose by number of cores
+   * @param ordering_partitions - number of ordering queue partitions,
+   * 0 to choose by number of cores
    * @param keypair - public and private keys for crypto provider
    */
   Irohad(const std::string &block_store_dir,
@@ -73,8 +89,15 @@ class Irohad {
          size_t internal_port,
          size_t max_proposal_size,
          std::chrono::milliseconds proposal_delay,
+         size_t max_queue_size,
+         const std::vector<iroha::ordering::LaneConfig> &ordering_lanes,
+         const std::string &ordering_wal_path,
+         bool compact_proposals,
          std::chrono::milliseconds vote_delay,
          std::chrono::milliseconds load_delay,
+         size_t vote_fanout,
+         size_t validation_workers,
+         size_t ordering_partitions,
          const iroha::keypair_t &keypair);
 
   /**
@@ -132,8 +155,15 @@ class Irohad {
   size_t internal_port_;
   size_t max_proposal_size_;
   std::chrono::milliseconds proposal_delay_;
+  size_t max_queue_size_;
+  std::vector<iroha::ordering::LaneConfig> ordering_lanes_;
+  std::string ordering_wal_path_;
+  bool compact_proposals_;
   std::chrono::milliseconds vote_delay_;
   std::chrono::milliseconds load_delay_;
+  size_t vote_fanout_;
+  size_t validation_workers_;
+  size_t ordering_partitions_;
 
   // ------------------------| internal dependencies |-------------------------
 
@@ -154,12 +184,24 @@ class Irohad {
   // peer query
   std::shared_ptr<iroha::ametsuchi::PeerQuery> wsv;
 
+  // timers of consensus
+  std::shared_ptr<iroha::TimerWheel> timer_wheel;
+
+  // timer of proposal generation
+  std::shared_ptr<iroha::TimerWheel> ordering_timer_wheel;
+
   // ordering gate
   std::shared_ptr<iroha::network::OrderingGate> ordering_gate;
 
   // simulator
   std::shared_ptr<iroha::simulator::Simulator> simulator;
 
+  // changes of own blocks, shared by simulator and synchronizer
+  std::shared_ptr<iroha::ametsuchi::WriteSetCache> write_sets;
+
+  // height of the last block reported to ordering service
+  iroha::model::Block::BlockHeightType ordering_committed_height{0};
+
   // block loader
   std::shared_ptr<iroha::network::BlockLoader> block_loader;
 
@@ -33,9 +33,8 @@ namespace iroha {
         return std::make_shared<PeerOrdererImpl>(wsv);
       }
 
-      auto YacInit::createNetwork() {
-        consensus_network =
-            std::make_shared<NetworkImpl>();
+      auto YacInit::createNetwork(std::shared_ptr<YacPeerOrderer> orderer) {
+        consensus_network = std::make_shared<NetworkImpl>(std::move(orderer));
         return consensus_network;
       }
 
@@ -45,7 +44,9 @@ namespace iroha {
         return crypto;
       }
 
-      auto YacInit::createTimer() { return std::make_shared<TimerImpl>(); }
+      auto YacInit::createTimer(std::shared_ptr<TimerWheel> timer_wheel) {
+        return std::make_shared<TimerImpl>(std::move(timer_wheel));
+      }
 
       auto YacInit::createHashProvider() {
         return std::make_shared<YacHashProviderImpl>();
@@ -53,15 +54,21 @@ namespace iroha {
 
       std::shared_ptr<consensus::yac::Yac> YacInit::createYac(
           ClusterOrdering initial_order,
+          std::shared_ptr<YacPeerOrderer> peer_orderer,
           const keypair_t &keypair,
-          std::chrono::milliseconds delay_milliseconds) {
+          std::chrono::milliseconds delay_milliseconds,
+          size_t vote_fanout,
+          std::shared_ptr<TimerWheel> timer_wheel) {
+        Dissemination dissemination;
+        dissemination.fanout = vote_fanout;
         return Yac::create(
             YacVoteStorage(),
-            createNetwork(),
+            createNetwork(std::move(peer_orderer)),
             createCryptoProvider(keypair),
-            createTimer(),
+            createTimer(std::move(timer_wheel)),
             initial_order,
-            delay_milliseconds.count());
+            delay_milliseconds.count(),
+            dissemination);
       }
 
       std::shared_ptr<YacGate> YacInit::initConsensusGate(
@@ -70,12 +77,17 @@ namespace iroha {
           std::shared_ptr<network::BlockLoader> block_loader,
           const keypair_t &keypair,
           std::chrono::milliseconds vote_delay_milliseconds,
-          std::chrono::milliseconds load_delay_milliseconds) {
+          std::chrono::milliseconds load_delay_milliseconds,
+          size_t vote_fanout,
+          std::shared_ptr<TimerWheel> timer_wheel) {
         auto peer_orderer = createPeerOrderer(wsv);
 
         auto yac = createYac(peer_orderer->getInitialOrdering().value(),
+                             peer_orderer,
                              keypair,
-                             vote_delay_milliseconds);
+                             vote_delay_milliseconds,
+                             vote_fanout,
+                             std::move(timer_wheel));
         consensus_network->subscribe(yac);
 
         auto hash_provider = createHashProvider();
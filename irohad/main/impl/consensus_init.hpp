@@ -32,6 +32,7 @@
 #include "consensus/yac/yac_peer_orderer.hpp"
 #include "network/block_loader.hpp"
 #include "simulator/block_creator.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -43,18 +44,21 @@ namespace iroha {
 
         auto createPeerOrderer(std::shared_ptr<ametsuchi::PeerQuery> wsv);
 
-        auto createNetwork();
+        auto createNetwork(std::shared_ptr<YacPeerOrderer> orderer);
 
         auto createCryptoProvider(const keypair_t &keypair);
 
-        auto createTimer();
+        auto createTimer(std::shared_ptr<TimerWheel> timer_wheel);
 
         auto createHashProvider();
 
         std::shared_ptr<consensus::yac::Yac> createYac(
             ClusterOrdering initial_order,
+            std::shared_ptr<YacPeerOrderer> peer_orderer,
             const keypair_t &keypair,
-            std::chrono::milliseconds delay_milliseconds);
+            std::chrono::milliseconds delay_milliseconds,
+            size_t vote_fanout,
+            std::shared_ptr<TimerWheel> timer_wheel);
 
        public:
         std::shared_ptr<YacGate> initConsensusGate(
@@ -63,7 +67,9 @@ namespace iroha {
             std::shared_ptr<network::BlockLoader> block_loader,
             const keypair_t &keypair,
             std::chrono::milliseconds vote_delay_milliseconds,
-            std::chrono::milliseconds load_delay_milliseconds);
+            std::chrono::milliseconds load_delay_milliseconds,
+            size_t vote_fanout,
+            std::shared_ptr<TimerWheel> timer_wheel);
 
         std::shared_ptr<NetworkImpl> consensus_network;
       };
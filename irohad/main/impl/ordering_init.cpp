@@ -31,22 +31,61 @@ namespace iroha {
         std::shared_ptr<ametsuchi::PeerQuery> wsv,
         size_t max_size,
         std::chrono::milliseconds delay_milliseconds,
-        std::shared_ptr<network::OrderingServiceTransport> transport) {
+        size_t max_queue_size,
+        size_t partitions,
+        const std::vector<ordering::LaneConfig> &lanes,
+        const std::string &wal_path,
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        std::shared_ptr<network::OrderingServiceTransport> transport,
+        std::shared_ptr<TimerWheel> timer_wheel) {
+      std::shared_ptr<ordering::OrderingWal> wal;
+      if (not wal_path.empty()) {
+        wal = ordering::OrderingWal::create(wal_path);
+      }
       return std::make_shared<ordering::OrderingServiceImpl>(
-          wsv, max_size, delay_milliseconds.count(), transport);
+          wsv,
+          max_size,
+          delay_milliseconds.count(),
+          transport,
+          timer_wheel,
+          max_queue_size,
+          partitions,
+          lanes,
+          wal,
+          block_query);
     }
 
     std::shared_ptr<ordering::OrderingGateImpl> OrderingInit::initOrderingGate(
         std::shared_ptr<ametsuchi::PeerQuery> wsv,
         size_t max_size,
-        std::chrono::milliseconds delay_milliseconds) {
+        std::chrono::milliseconds delay_milliseconds,
+        size_t max_queue_size,
+        size_t partitions,
+        const std::vector<ordering::LaneConfig> &lanes,
+        const std::string &wal_path,
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        bool compact_proposals,
+        std::shared_ptr<TimerWheel> timer_wheel) {
       auto network_address = wsv->getLedgerPeers().value().front().address;
       ordering_gate_transport =
           std::make_shared<iroha::ordering::OrderingGateTransportGrpc>(
               network_address);
 
-      ordering_service_transport = std::make_shared<ordering::OrderingServiceTransportGrpc>();
-      ordering_service = createService(wsv, max_size, delay_milliseconds, ordering_service_transport);
+      // transactions are not gossiped between peers, so in compact mode
+      // a peer fetches bodies of transactions received by other peers
+      ordering_service_transport =
+          std::make_shared<ordering::OrderingServiceTransportGrpc>(
+              compact_proposals);
+      ordering_service = createService(wsv,
+                                       max_size,
+                                       delay_milliseconds,
+                                       max_queue_size,
+                                       partitions,
+                                       lanes,
+                                       wal_path,
+                                       block_query,
+                                       ordering_service_transport,
+                                       timer_wheel);
       ordering_service_transport->subscribe(ordering_service);
       ordering_gate = createGate(ordering_gate_transport);
       return ordering_gate;
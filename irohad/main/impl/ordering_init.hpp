@@ -18,6 +18,7 @@
 #ifndef IROHA_ORDERING_INIT_HPP
 #define IROHA_ORDERING_INIT_HPP
 
+#include "ametsuchi/block_query.hpp"
 #include "ametsuchi/peer_query.hpp"
 #include "ordering/impl/ordering_gate_impl.hpp"
 #include "ordering/impl/ordering_gate_transport_grpc.hpp"
@@ -45,13 +46,27 @@ namespace iroha {
        * @param peers - endpoints of peers for connection
        * @param max_size - limitation of proposal size
        * @param delay_milliseconds - delay before emitting proposal
+       * @param max_queue_size - high-water mark of transaction queue
+       * @param partitions - number of transaction queue partitions
+       * @param lanes - weighted lanes of transaction queue
+       * @param wal_path - directory of transaction queue write-ahead log,
+       * log is disabled if empty
+       * @param block_query - ledger, recovered transactions committed to it
+       * are not queued again
        * @param loop - handler of async events
+       * @param timer_wheel - timer for proposal generation
        */
       auto createService(
           std::shared_ptr<ametsuchi::PeerQuery> wsv,
           size_t max_size,
           std::chrono::milliseconds delay_milliseconds,
-          std::shared_ptr<network::OrderingServiceTransport> transport);
+          size_t max_queue_size,
+          size_t partitions,
+          const std::vector<ordering::LaneConfig> &lanes,
+          const std::string &wal_path,
+          std::shared_ptr<ametsuchi::BlockQuery> block_query,
+          std::shared_ptr<network::OrderingServiceTransport> transport,
+          std::shared_ptr<TimerWheel> timer_wheel);
 
      public:
       /**
@@ -60,12 +75,27 @@ namespace iroha {
        * @param loop - handler of async events
        * @param max_size - limitation of proposal size
        * @param delay_milliseconds - delay before emitting proposal
+       * @param max_queue_size - high-water mark of transaction queue
+       * @param partitions - number of transaction queue partitions
+       * @param lanes - weighted lanes of transaction queue
+       * @param wal_path - directory of transaction queue write-ahead log,
+       * log is disabled if empty
+       * @param block_query - ledger for checking recovered transactions
+       * @param compact_proposals - send proposals as transaction hashes
+       * @param timer_wheel - timer for proposal generation
        * @return effective realisation of OrderingGate
        */
       std::shared_ptr<ordering::OrderingGateImpl> initOrderingGate(
           std::shared_ptr<ametsuchi::PeerQuery> wsv,
           size_t max_size,
-          std::chrono::milliseconds delay_milliseconds);
+          std::chrono::milliseconds delay_milliseconds,
+          size_t max_queue_size,
+          size_t partitions,
+          const std::vector<ordering::LaneConfig> &lanes,
+          const std::string &wal_path,
+          std::shared_ptr<ametsuchi::BlockQuery> block_query,
+          bool compact_proposals,
+          std::shared_ptr<TimerWheel> timer_wheel);
 
       std::shared_ptr<ordering::OrderingServiceImpl> ordering_service;
       std::shared_ptr<ordering::OrderingGateImpl> ordering_gate;
@@ -34,8 +34,19 @@ namespace config_members {
   const char* RedisPort = "redis_port";
   const char* MaxProposalSize = "max_proposal_size";
   const char* ProposalDelay = "proposal_delay";
+  const char* MaxQueueSize = "max_queue_size";
+  const char* OrderingLanes = "ordering_lanes";
+  const char* LaneName = "name";
+  const char* LaneWeight = "weight";
+  const char* LaneAccounts = "accounts";
+  const char* LaneDomains = "domains";
+  const char* OrderingWalPath = "ordering_wal_path";
+  const char* CompactProposals = "compact_proposals";
   const char* VoteDelay = "vote_delay";
   const char* LoadDelay = "load_delay";
+  const char* VoteFanout = "vote_fanout";
+  const char* ValidationWorkers = "validation_workers";
+  const char* OrderingPartitions = "ordering_partitions";
 }  // namespace config_members
 
 /**
@@ -84,6 +95,48 @@ inline rapidjson::Document parse_iroha_config(std::string const& iroha_conf_path
   assert_fatal(doc[mbr::ProposalDelay].IsUint(),
                type_error(mbr::ProposalDelay, "uint"));
 
+  assert_fatal(doc.HasMember(mbr::MaxQueueSize), no_member_error(mbr::MaxQueueSize));
+  assert_fatal(doc[mbr::MaxQueueSize].IsUint(),
+               type_error(mbr::MaxQueueSize, "uint"));
+
+  // optional, all transactions share the default lane without it
+  if (doc.HasMember(mbr::OrderingLanes)) {
+    assert_fatal(doc[mbr::OrderingLanes].IsArray(),
+                 type_error(mbr::OrderingLanes, "array"));
+    for (const auto& lane : doc[mbr::OrderingLanes].GetArray()) {
+      assert_fatal(lane.IsObject(), type_error(mbr::OrderingLanes, "object"));
+      assert_fatal(lane.HasMember(mbr::LaneName),
+                   no_member_error(mbr::LaneName));
+      assert_fatal(lane[mbr::LaneName].IsString(),
+                   type_error(mbr::LaneName, "string"));
+      assert_fatal(lane.HasMember(mbr::LaneWeight),
+                   no_member_error(mbr::LaneWeight));
+      assert_fatal(lane[mbr::LaneWeight].IsUint(),
+                   type_error(mbr::LaneWeight, "uint"));
+      for (auto member : {mbr::LaneAccounts, mbr::LaneDomains}) {
+        if (not lane.HasMember(member)) {
+          continue;
+        }
+        assert_fatal(lane[member].IsArray(), type_error(member, "array"));
+        for (const auto& item : lane[member].GetArray()) {
+          assert_fatal(item.IsString(), type_error(member, "string"));
+        }
+      }
+    }
+  }
+
+  // optional, ordering queue is kept in memory only without it
+  if (doc.HasMember(mbr::OrderingWalPath)) {
+    assert_fatal(doc[mbr::OrderingWalPath].IsString(),
+                 type_error(mbr::OrderingWalPath, "string"));
+  }
+
+  // optional, proposals carry full transactions without it
+  if (doc.HasMember(mbr::CompactProposals)) {
+    assert_fatal(doc[mbr::CompactProposals].IsBool(),
+                 type_error(mbr::CompactProposals, "bool"));
+  }
+
   assert_fatal(doc.HasMember(mbr::VoteDelay), no_member_error(mbr::VoteDelay));
   assert_fatal(doc[mbr::VoteDelay].IsUint(),
                type_error(mbr::VoteDelay, "uint"));
@@ -91,6 +144,19 @@ inline rapidjson::Document parse_iroha_config(std::string const& iroha_conf_path
   assert_fatal(doc.HasMember(mbr::LoadDelay), no_member_error(mbr::LoadDelay));
   assert_fatal(doc[mbr::LoadDelay].IsUint(),
                type_error(mbr::LoadDelay, "uint"));
+
+  // optional, commits are sent to every peer directly without it
+  if (doc.HasMember(mbr::VoteFanout)) {
+    assert_fatal(doc[mbr::VoteFanout].IsUint(),
+                 type_error(mbr::VoteFanout, "uint"));
+  }
+
+  // optional, chosen by number of cores without them
+  for (auto member : {mbr::ValidationWorkers, mbr::OrderingPartitions}) {
+    if (doc.HasMember(member)) {
+      assert_fatal(doc[member].IsUint(), type_error(member, "uint"));
+    }
+  }
   return doc;
 }
 
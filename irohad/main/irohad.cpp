@@ -70,6 +70,25 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  std::vector<iroha::ordering::LaneConfig> ordering_lanes;
+  if (config.HasMember(mbr::OrderingLanes)) {
+    for (const auto &lane : config[mbr::OrderingLanes].GetArray()) {
+      iroha::ordering::LaneConfig lane_config{
+          lane[mbr::LaneName].GetString(), lane[mbr::LaneWeight].GetUint()};
+      if (lane.HasMember(mbr::LaneAccounts)) {
+        for (const auto &account : lane[mbr::LaneAccounts].GetArray()) {
+          lane_config.accounts.push_back(account.GetString());
+        }
+      }
+      if (lane.HasMember(mbr::LaneDomains)) {
+        for (const auto &domain : lane[mbr::LaneDomains].GetArray()) {
+          lane_config.domains.push_back(domain.GetString());
+        }
+      }
+      ordering_lanes.push_back(std::move(lane_config));
+    }
+  }
+
   Irohad irohad(config[mbr::BlockStorePath].GetString(),
                 config[mbr::RedisHost].GetString(),
                 config[mbr::RedisPort].GetUint(),
@@ -78,8 +97,24 @@ int main(int argc, char *argv[]) {
                 config[mbr::InternalPort].GetUint(),
                 config[mbr::MaxProposalSize].GetUint(),
                 std::chrono::milliseconds(config[mbr::ProposalDelay].GetUint()),
+                config[mbr::MaxQueueSize].GetUint(),
+                ordering_lanes,
+                config.HasMember(mbr::OrderingWalPath)
+                    ? config[mbr::OrderingWalPath].GetString()
+                    : "",
+                config.HasMember(mbr::CompactProposals)
+                    and config[mbr::CompactProposals].GetBool(),
                 std::chrono::milliseconds(config[mbr::VoteDelay].GetUint()),
                 std::chrono::milliseconds(config[mbr::LoadDelay].GetUint()),
+                config.HasMember(mbr::VoteFanout)
+                    ? config[mbr::VoteFanout].GetUint()
+                    : 0,
+                config.HasMember(mbr::ValidationWorkers)
+                    ? config[mbr::ValidationWorkers].GetUint()
+                    : 0,
+                config.HasMember(mbr::OrderingPartitions)
+                    ? config[mbr::OrderingPartitions].GetUint()
+                    : 0,
                 keypair);
 
   if (not irohad.storage) {
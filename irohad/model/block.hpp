@@ -77,8 +77,7 @@ namespace iroha {
       uint16_t txs_number{};
 
       /**
-       * Root of merkle tree based on the block and all previous blocks
-       * in the ledger
+       * Root of merkle tree over hashes of attached transactions
        * part of PAYLOAD
        */
       hash256_t merkle_root{};
@@ -24,6 +24,7 @@
 #include "model/queries/get_asset_info.hpp"
 #include "model/queries/get_roles.hpp"
 #include "model/queries/get_signatories.hpp"
+#include "model/queries/get_transaction_proof.hpp"
 #include "model/queries/get_transactions.hpp"
 
 namespace iroha {
@@ -46,6 +47,8 @@ namespace iroha {
         serializers_[typeid(GetAssetInfo)] =
             &PbQueryFactory::serializeGetAssetInfo;
         serializers_[typeid(GetRoles)] = &PbQueryFactory::serializeGetRoles;
+        serializers_[typeid(GetTransactionProof)] =
+            &PbQueryFactory::serializeGetTransactionProof;
       }
 
       optional_ptr<model::Query> PbQueryFactory::deserialize(
@@ -113,6 +116,15 @@ namespace iroha {
               val = std::make_shared <GetRolePermissions>(pb_cast.role_id());
               break;
             }
+            case Query_Payload::QueryCase::kGetTransactionProof: {
+              const auto &pb_cast = pl.get_transaction_proof();
+              if (pb_cast.tx_hash().size() != hash256_t::size()) {
+                return nonstd::nullopt;
+              }
+              val = std::make_shared<GetTransactionProof>(
+                  hash256_t::from_string(pb_cast.tx_hash()));
+              break;
+            }
             default: {
               // Query not implemented
               return nonstd::nullopt;
@@ -250,6 +262,17 @@ namespace iroha {
         return pb_query;
       }
 
+      protocol::Query PbQueryFactory::serializeGetTransactionProof(
+          std::shared_ptr<const Query> query) const {
+        protocol::Query pb_query;
+        serializeQueryMetaData(pb_query, query);
+        auto tmp = std::static_pointer_cast<const GetTransactionProof>(query);
+        auto pb_query_mut =
+            pb_query.mutable_payload()->mutable_get_transaction_proof();
+        pb_query_mut->set_tx_hash(tmp->tx_hash.to_string());
+        return pb_query;
+      }
+
     }  // namespace converters
   }    // namespace model
 }  // namespace iroha
@@ -75,6 +75,13 @@ namespace iroha {
                   static_cast<model::RolePermissionsResponse &>(
                       *query_response)));
         }
+        if (instanceof <model::TransactionProofResponse>(*query_response)) {
+          response = nonstd::make_optional<protocol::QueryResponse>();
+          response->mutable_transaction_proof_response()->CopyFrom(
+              serializeTransactionProofResponse(
+                  static_cast<model::TransactionProofResponse &>(
+                      *query_response)));
+        }
 
         return response;
       }
@@ -258,6 +265,34 @@ namespace iroha {
             .first();
       }
 
+      protocol::TransactionProofResponse
+      PbQueryResponseFactory::serializeTransactionProofResponse(
+          const model::TransactionProofResponse &response) const {
+        protocol::TransactionProofResponse res;
+        res.set_height(response.height);
+        res.set_merkle_root(response.merkle_root.to_string());
+        res.set_index(response.proof.index);
+        res.set_leaves_number(response.proof.leaves_number);
+        for (const auto &node : response.proof.path) {
+          res.add_path(node.to_string());
+        }
+        return res;
+      }
+
+      model::TransactionProofResponse
+      PbQueryResponseFactory::deserializeTransactionProofResponse(
+          const protocol::TransactionProofResponse &response) const {
+        model::TransactionProofResponse res;
+        res.height = response.height();
+        res.merkle_root = hash256_t::from_string(response.merkle_root());
+        res.proof.index = response.index();
+        res.proof.leaves_number = response.leaves_number();
+        for (const auto &node : response.path()) {
+          res.proof.path.push_back(hash256_t::from_string(node));
+        }
+        return res;
+      }
+
       protocol::ErrorResponse PbQueryResponseFactory::serializeErrorResponse(
           const model::ErrorResponse &errorResponse) const {
         protocol::ErrorResponse pb_response;
@@ -286,6 +321,9 @@ namespace iroha {
           case ErrorResponse::NO_ROLES:
             pb_response.set_reason(protocol::ErrorResponse::NO_ROLES);
             break;
+          case ErrorResponse::NO_TRANSACTION:
+            pb_response.set_reason(protocol::ErrorResponse::NO_TRANSACTION);
+            break;
         }
         return pb_response;
       }
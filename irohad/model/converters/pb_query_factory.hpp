@@ -69,6 +69,8 @@ namespace iroha {
             std::shared_ptr<const Query> query) const;
         protocol::Query serializeGetRolePermissions(
             std::shared_ptr<const Query> query) const;
+        protocol::Query serializeGetTransactionProof(
+            std::shared_ptr<const Query> query) const;
 
         /**
          * Serialize and add meta data of model query to proto query
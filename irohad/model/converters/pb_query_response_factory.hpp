@@ -28,6 +28,7 @@
 #include "model/queries/responses/transactions_response.hpp"
 #include "model/queries/responses/roles_response.hpp"
 #include "model/queries/responses/asset_response.hpp"
+#include "model/queries/responses/transaction_proof_response.hpp"
 
 namespace iroha {
   namespace model {
@@ -85,6 +86,11 @@ namespace iroha {
         model::RolePermissionsResponse deserializeRolePermissionsResponse(
             const protocol::RolePermissionsResponse &response) const;
 
+        protocol::TransactionProofResponse serializeTransactionProofResponse(
+            const model::TransactionProofResponse &response) const;
+        model::TransactionProofResponse deserializeTransactionProofResponse(
+            const protocol::TransactionProofResponse &response) const;
+
         protocol::ErrorResponse serializeErrorResponse(
             const model::ErrorResponse &errorResponse) const;
       };
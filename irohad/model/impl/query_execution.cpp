@@ -25,6 +25,7 @@
 #include "model/queries/responses/error_response.hpp"
 #include "model/queries/responses/roles_response.hpp"
 #include "model/queries/responses/signatories_response.hpp"
+#include "model/queries/responses/transaction_proof_response.hpp"
 #include "model/queries/responses/transactions_response.hpp"
 
 using namespace iroha::model;
@@ -114,6 +115,41 @@ bool iroha::model::QueryProcessingFactory::validate(
                          can_get_my_acc_ast_txs, can_get_all_acc_ast_txs);
 }
 
+bool QueryProcessingFactory::validate(const model::GetTransactionProof& query) {
+  // TODO: check signatures
+  // proof reveals only position of already known hash in the block
+  return checkAccountRolePermission(query.creator_account_id, *_wsvQuery,
+                                    can_get_my_acc_txs)
+      or checkAccountRolePermission(query.creator_account_id, *_wsvQuery,
+                                    can_get_all_acc_txs);
+}
+
+std::shared_ptr<iroha::model::QueryResponse>
+QueryProcessingFactory::executeGetTransactionProof(
+    const model::GetTransactionProof& query) {
+  auto block = _blockQuery->getBlockByTxHashSync(query.tx_hash.to_string());
+  nonstd::optional<MerkleProof> proof;
+  if (block) {
+    auto tx_hashes = iroha::hash(block->transactions);
+    auto it = std::find(tx_hashes.begin(), tx_hashes.end(), query.tx_hash);
+    if (it != tx_hashes.end()) {
+      proof = merkleProof(tx_hashes, std::distance(tx_hashes.begin(), it));
+    }
+  }
+  if (not proof) {
+    ErrorResponse response;
+    response.query_hash = iroha::hash(query);
+    response.reason = ErrorResponse::NO_TRANSACTION;
+    return std::make_shared<ErrorResponse>(response);
+  }
+  TransactionProofResponse response;
+  response.query_hash = iroha::hash(query);
+  response.height = block->height;
+  response.merkle_root = block->merkle_root;
+  response.proof = std::move(proof.value());
+  return std::make_shared<TransactionProofResponse>(response);
+}
+
 std::shared_ptr<iroha::model::QueryResponse>
 QueryProcessingFactory::executeGetAssetInfo(const model::GetAssetInfo& query) {
   auto ast = _wsvQuery->getAsset(query.asset_id);
@@ -323,6 +359,16 @@ iroha::model::QueryProcessingFactory::execute(
     }
     return executeGetAssetInfo(*qry);
   }
+  if (instanceof <GetTransactionProof>(query.get())) {
+    auto qry = std::static_pointer_cast<const GetTransactionProof>(query);
+    if (not validate(*qry)) {
+      ErrorResponse response;
+      response.query_hash = iroha::hash(*qry);
+      response.reason = ErrorResponse::STATEFUL_INVALID;
+      return std::make_shared<ErrorResponse>(response);
+    }
+    return executeGetTransactionProof(*qry);
+  }
   iroha::model::ErrorResponse response;
   response.query_hash = iroha::hash(*query);
   response.reason = model::ErrorResponse::NOT_SUPPORTED;
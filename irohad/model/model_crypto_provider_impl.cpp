@@ -29,7 +29,7 @@
 namespace iroha {
   namespace model {
     ModelCryptoProviderImpl::ModelCryptoProviderImpl(const keypair_t &keypair)
-        : keypair_(keypair) {}
+        : signer_(keypair) {}
 
     bool ModelCryptoProviderImpl::verify(const Transaction &tx) const {
       return std::all_of(tx.signatures.begin(),
@@ -56,25 +56,21 @@ namespace iroha {
     }
 
     void ModelCryptoProviderImpl::sign(Block &block) const {
-      auto signature = iroha::sign(
-          iroha::hash(block).to_string(), keypair_.pubkey, keypair_.privkey);
+      auto signature = signer_.sign(iroha::hash(block).to_string());
 
-      block.sigs.emplace_back(signature, keypair_.pubkey);
+      block.sigs.emplace_back(signature, signer_.publicKey());
     }
 
     void ModelCryptoProviderImpl::sign(Transaction &transaction) const {
-      auto signature = iroha::sign(iroha::hash(transaction).to_string(),
-                                   keypair_.pubkey,
-                                   keypair_.privkey);
+      auto signature = signer_.sign(iroha::hash(transaction).to_string());
 
-      transaction.signatures.emplace_back(signature, keypair_.pubkey);
+      transaction.signatures.emplace_back(signature, signer_.publicKey());
     }
 
     void ModelCryptoProviderImpl::sign(Query &query) const {
-      auto signature = iroha::sign(
-          iroha::hash(query).to_string(), keypair_.pubkey, keypair_.privkey);
+      auto signature = signer_.sign(iroha::hash(query).to_string());
 
-      query.signature = Signature{signature, keypair_.pubkey};
+      query.signature = Signature{signature, signer_.publicKey()};
     }
   }
 }
@@ -18,6 +18,7 @@
 #ifndef IROHA_MODEL_CRYPTO_PROVIDER_IMPL_HPP
 #define IROHA_MODEL_CRYPTO_PROVIDER_IMPL_HPP
 
+#include "crypto/signer.hpp"
 #include "model_crypto_provider.hpp"
 
 namespace iroha {
@@ -40,7 +41,7 @@ namespace iroha {
       void sign(Query &query) const override;
 
      private:
-      keypair_t keypair_;
+      Signer signer_;
     };
   }
 }
@@ -63,7 +63,11 @@ namespace iroha {
         /**
          * when unidentified request was received
          */
-        NOT_SUPPORTED
+        NOT_SUPPORTED,
+        /**
+         * when requested transaction does not exist
+         */
+        NO_TRANSACTION
       };
       Reason reason{};
     };
@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_TRANSACTION_PROOF_RESPONSE_HPP
+#define IROHA_TRANSACTION_PROOF_RESPONSE_HPP
+
+#include "common/types.hpp"
+#include "crypto/merkle.hpp"
+#include "model/query_response.hpp"
+
+namespace iroha {
+  namespace model {
+
+    /**
+     * Provide merkle audit path of transaction hash,
+     * it can be checked against merkle root of block header
+     */
+    struct TransactionProofResponse : public QueryResponse {
+      /**
+       * Height of block containing the transaction
+       */
+      uint64_t height{};
+
+      /**
+       * Merkle root of the block
+       */
+      hash256_t merkle_root{};
+
+      /**
+       * Audit path from transaction hash to merkle root
+       */
+      MerkleProof proof{};
+    };
+  }  // namespace model
+}  // namespace iroha
+#endif  // IROHA_TRANSACTION_PROOF_RESPONSE_HPP
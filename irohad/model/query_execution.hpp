@@ -26,6 +26,7 @@
 #include "model/queries/get_asset_info.hpp"
 #include "model/queries/get_roles.hpp"
 #include "model/queries/get_signatories.hpp"
+#include "model/queries/get_transaction_proof.hpp"
 #include "model/queries/get_transactions.hpp"
 
 #include "ametsuchi/block_query.hpp"
@@ -72,6 +73,8 @@ namespace iroha {
 
       bool validate(const model::GetAccountAssetTransactions& query);
 
+      bool validate(const model::GetTransactionProof& query);
+
       std::shared_ptr<iroha::model::QueryResponse> executeGetAssetInfo(
           const model::GetAssetInfo& query);
 
@@ -97,6 +100,9 @@ namespace iroha {
       std::shared_ptr<iroha::model::QueryResponse>
       executeGetAccountTransactions(const model::GetAccountTransactions& query);
 
+      std::shared_ptr<iroha::model::QueryResponse> executeGetTransactionProof(
+          const model::GetTransactionProof& query);
+
       std::shared_ptr<ametsuchi::WsvQuery> _wsvQuery;
       std::shared_ptr<ametsuchi::BlockQuery> _blockQuery;
     };
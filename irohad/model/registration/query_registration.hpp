@@ -26,6 +26,7 @@
 #include "model/queries/get_asset_info.hpp"
 #include "model/queries/get_roles.hpp"
 #include "model/queries/get_signatories.hpp"
+#include "model/queries/get_transaction_proof.hpp"
 #include "model/queries/get_transactions.hpp"
 
 /**
@@ -46,6 +47,7 @@ namespace iroha {
         query_handler.register_type(typeid(GetRoles));
         query_handler.register_type(typeid(GetAssetInfo));
         query_handler.register_type(typeid(GetRolePermissions));
+        query_handler.register_type(typeid(GetTransactionProof));
       }
 
       ClassHandler query_handler{};
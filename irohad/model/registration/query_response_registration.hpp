@@ -28,6 +28,7 @@
 #include "model/queries/responses/transactions_response.hpp"
 #include "model/queries/responses/asset_response.hpp"
 #include "model/queries/responses/roles_response.hpp"
+#include "model/queries/responses/transaction_proof_response.hpp"
 
 
 /**
@@ -48,6 +49,7 @@ namespace iroha {
         query_response_handler.register_type(typeid(AssetResponse));
         query_response_handler.register_type(typeid(RolesResponse));
         query_response_handler.register_type(typeid(RolePermissionsResponse));
+        query_response_handler.register_type(typeid(TransactionProofResponse));
       }
 
       ClassHandler query_response_handler{};
@@ -35,7 +35,7 @@ namespace iroha {
       /**
        * Retrieve block from given peer starting from current top
        * @param peer_pubkey - peer for requesting blocks
-       * @return
+       * @return blocks as they are received, signatures are not verified
        */
       virtual rxcpp::observable<model::Block> retrieveBlocks(
           model::Peer::KeyType peer_pubkey) = 0;
@@ -20,6 +20,7 @@
 
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
+#include <functional>
 #include <thread>
 
 namespace iroha {
@@ -27,6 +28,7 @@ namespace iroha {
 
     /**
      * Asynchronous gRPC client which does no processing of server responses
+     * except for calls with a response handler
      * @tparam Response type of server response
      */
     template <typename Response>
@@ -42,6 +44,9 @@ namespace iroha {
         auto ok = false;
         while (cq_.Next(&got_tag, &ok)) {
           auto call = static_cast<AsyncClientCall *>(got_tag);
+          if (call->on_response) {
+            call->on_response(call->reply, call->status);
+          }
 
           delete call;
         }
@@ -69,6 +74,14 @@ namespace iroha {
 
         std::unique_ptr<grpc::ClientAsyncResponseReader<Response>>
             response_reader;
+
+        /**
+         * Optional handler of completed call, invoked on the client thread.
+         * Calls are drained after the owner of the client is destroyed,
+         * so the handler must not refer to it
+         */
+        std::function<void(const Response &, const grpc::Status &)>
+            on_response;
       };
     };
   }  // namespace network
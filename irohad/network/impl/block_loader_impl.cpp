@@ -63,14 +63,14 @@ rxcpp::observable<Block> BlockLoaderImpl::retrieveBlocks(
 
         auto reader =
             this->getPeerStub(peer.value()).retrieveBlocks(&context, request);
-        while (reader->Read(&block)) {
-          auto &&result = factory_.deserialize(block);
-          if (not crypto_provider_->verify(result)) {
-            log_->error("Block signatures are invalid");
-            context.TryCancel();
-          } else {
-            subscriber.on_next(result);
-          }
+        // signatures are verified by chain validator, in parallel with
+        // applying of previous blocks
+        while (subscriber.is_subscribed() and reader->Read(&block)) {
+          subscriber.on_next(factory_.deserialize(block));
+        }
+        if (not subscriber.is_subscribed()) {
+          // rest of the chain is not needed, stop the peer sending it
+          context.TryCancel();
         }
         reader->Finish();
         subscriber.on_completed();
@@ -0,0 +1,95 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_PEER_CHANNEL_REGISTRY_HPP
+#define IROHA_PEER_CHANNEL_REGISTRY_HPP
+
+#include <grpc++/grpc++.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Long-lived gRPC stubs of peers. Channel to a peer is created once and
+     * reused by all following calls while the peer stays in the list
+     * @tparam Service - generated gRPC service of remote peers
+     */
+    template <typename Service>
+    class PeerChannelRegistry {
+     public:
+      using Stub = typename Service::Stub;
+
+      /**
+       * Get stubs for the peers. When the list differs from the previous
+       * one, the registry is refreshed: stubs of remaining peers are kept,
+       * channels to new peers are opened and removed peers are dropped
+       * @param peers - addresses of current peers
+       * @return stubs in order of peers, one per distinct address
+       */
+      std::vector<std::shared_ptr<Stub>> stubs(
+          const std::vector<std::string> &peers) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (peers != peers_) {
+          refresh(peers);
+        }
+        return ordered_;
+      }
+
+      /**
+       * @return number of open channels
+       */
+      size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return registry_.size();
+      }
+
+     private:
+      void refresh(const std::vector<std::string> &peers) {
+        std::unordered_map<std::string, std::shared_ptr<Stub>> registry;
+        std::vector<std::shared_ptr<Stub>> ordered;
+        ordered.reserve(peers.size());
+        for (const auto &peer : peers) {
+          if (registry.count(peer) != 0) {
+            continue;
+          }
+          auto it = registry_.find(peer);
+          auto stub = it != registry_.end()
+              ? it->second
+              : std::shared_ptr<Stub>(Service::NewStub(grpc::CreateChannel(
+                    peer, grpc::InsecureChannelCredentials())));
+          registry.emplace(peer, stub);
+          ordered.push_back(stub);
+        }
+        registry_.swap(registry);
+        ordered_.swap(ordered);
+        peers_ = peers;
+      }
+
+      mutable std::mutex mutex_;
+      std::vector<std::string> peers_;
+      std::vector<std::shared_ptr<Stub>> ordered_;
+      std::unordered_map<std::string, std::shared_ptr<Stub>> registry_;
+    };
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_PEER_CHANNEL_REGISTRY_HPP
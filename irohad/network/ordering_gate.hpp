@@ -43,6 +43,16 @@ namespace iroha {
        */
       virtual rxcpp::observable<model::Proposal> on_proposal() = 0;
 
+      /**
+       * @return number of transactions waiting for ordering
+       */
+      virtual size_t queueDepth() const = 0;
+
+      /**
+       * @return true while ordering service rejects new transactions
+       */
+      virtual bool overloaded() const = 0;
+
       virtual ~OrderingGate() = default;
     };
   }  // namespace network
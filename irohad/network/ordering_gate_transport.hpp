@@ -60,6 +60,18 @@ namespace iroha {
       virtual void propagate_transaction(
           std::shared_ptr<const model::Transaction> transaction) = 0;
 
+      /**
+       * @return number of transactions waiting for proposal, as last reported
+       * by ordering service, including ones not sent yet
+       */
+      virtual size_t queueDepth() const = 0;
+
+      /**
+       * @return true for a short backoff after ordering service rejected
+       * transactions because its queue was full
+       */
+      virtual bool overloaded() const = 0;
+
       virtual ~OrderingGateTransport() = default;
     };
 
@@ -35,6 +35,17 @@ namespace iroha {
        */
       virtual void onTransaction(const model::Transaction &transaction) = 0;
 
+      /**
+       * @return number of transactions waiting for proposal
+       */
+      virtual size_t queueDepth() const = 0;
+
+      /**
+       * @return true if the queue is at its high-water mark and new
+       * transactions are dropped
+       */
+      virtual bool queueFull() const = 0;
+
       virtual ~OrderingServiceNotification() = default;
     };
 
@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/delay_histogram.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    constexpr size_t DelayHistogram::BUCKETS;
+
+    DelayHistogram::DelayHistogram() {
+      for (auto &count : counts_) {
+        count = 0;
+      }
+    }
+
+    void DelayHistogram::record(std::chrono::steady_clock::duration delay) {
+      auto us = std::chrono::duration_cast<std::chrono::microseconds>(delay)
+                    .count();
+      if (us < 0) {
+        us = 0;
+      }
+      size_t bucket = 0;
+      for (auto ms = us / 1000; ms > 0 and bucket < BUCKETS - 1; ms >>= 1) {
+        ++bucket;
+      }
+      ++counts_[bucket];
+      total_us_ += us;
+    }
+
+    DelayHistogram::Snapshot DelayHistogram::snapshot() const {
+      Snapshot snapshot;
+      for (size_t i = 0; i < BUCKETS; ++i) {
+        snapshot.counts[i] = counts_[i];
+        snapshot.count += snapshot.counts[i];
+      }
+      snapshot.total = std::chrono::microseconds(total_us_);
+      return snapshot;
+    }
+
+    std::chrono::milliseconds DelayHistogram::upperBound(size_t bucket) {
+      if (bucket >= BUCKETS - 1) {
+        return std::chrono::milliseconds(1ll << (BUCKETS - 2));
+      }
+      return std::chrono::milliseconds(1ll << bucket);
+    }
+
+    std::chrono::milliseconds DelayHistogram::Snapshot::percentile(
+        double fraction) const {
+      if (count == 0) {
+        return std::chrono::milliseconds(0);
+      }
+      uint64_t seen = 0;
+      for (size_t i = 0; i < BUCKETS; ++i) {
+        seen += counts[i];
+        if (seen > 0 and seen >= fraction * count) {
+          return upperBound(i);
+        }
+      }
+      return upperBound(BUCKETS - 1);
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
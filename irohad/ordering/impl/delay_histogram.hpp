@@ -0,0 +1,70 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_DELAY_HISTOGRAM_HPP
+#define IROHA_DELAY_HISTOGRAM_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Concurrent histogram of delays with power of two millisecond buckets:
+     * bucket 0 counts delays below 1 ms, bucket i delays below 2^i ms,
+     * the last bucket counts everything longer.
+     */
+    class DelayHistogram {
+     public:
+      static constexpr size_t BUCKETS = 16;
+
+      struct Snapshot {
+        std::array<uint64_t, BUCKETS> counts{};
+        uint64_t count = 0;
+        std::chrono::microseconds total{0};
+
+        /**
+         * @param fraction - part of observations, in [0, 1]
+         * @return upper bound of the bucket containing the percentile,
+         * zero when nothing was recorded
+         */
+        std::chrono::milliseconds percentile(double fraction) const;
+      };
+
+      DelayHistogram();
+
+      void record(std::chrono::steady_clock::duration delay);
+
+      Snapshot snapshot() const;
+
+      /**
+       * @return exclusive upper bound of delays counted in the bucket,
+       * the last bucket is unbounded and reports its lower bound
+       */
+      static std::chrono::milliseconds upperBound(size_t bucket);
+
+     private:
+      std::array<std::atomic<uint64_t>, BUCKETS> counts_;
+      std::atomic<uint64_t> total_us_{0};
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_DELAY_HISTOGRAM_HPP
@@ -37,6 +37,14 @@ namespace iroha {
       return proposals_.get_observable();
     }
 
+    size_t OrderingGateImpl::queueDepth() const {
+      return transport_->queueDepth();
+    }
+
+    bool OrderingGateImpl::overloaded() const {
+      return transport_->overloaded();
+    }
+
     void OrderingGateImpl::onProposal(model::Proposal proposal) {
       log_->info("Received new proposal");
       proposals_.get_subscriber().on_next(proposal);
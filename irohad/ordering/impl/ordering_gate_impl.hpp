@@ -45,6 +45,10 @@ namespace iroha {
 
       rxcpp::observable<model::Proposal> on_proposal() override;
 
+      size_t queueDepth() const override;
+
+      bool overloaded() const override;
+
       void onProposal(model::Proposal proposal) override;
 
      private:
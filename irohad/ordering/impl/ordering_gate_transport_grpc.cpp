@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 #include "ordering_gate_transport_grpc.hpp"
+#include <algorithm>
+#include "model/converters/pb_common.hpp"
 
 using namespace iroha::ordering;
 
@@ -32,32 +34,241 @@ grpc::Status OrderingGateTransportGrpc::onProposal(
 
   model::Proposal proposal(transactions);
   proposal.height = request->height();
+  emitProposal(std::move(proposal));
+
+  return grpc::Status::OK;
+}
+
+grpc::Status OrderingGateTransportGrpc::onCompactProposal(
+    ::grpc::ServerContext *context,
+    const proto::CompactProposal *request,
+    ::google::protobuf::Empty *response) {
+  log_->info("receive compact proposal");
+
+  std::vector<std::shared_ptr<const model::Transaction>> found(
+      request->hashes_size());
+  std::vector<size_t> missing;
+  proto::TransactionsRequest fetch;
+  {
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    for (int i = 0; i < request->hashes_size(); ++i) {
+      auto it = pool_.find(request->hashes(i));
+      if (it == pool_.end()) {
+        missing.push_back(i);
+        fetch.add_hashes(request->hashes(i));
+        continue;
+      }
+      found[i] = std::move(it->second.transaction);
+      pool_order_.erase(it->second.order);
+      pool_.erase(it);
+    }
+  }
+  log_->info("transactions in proposal: {}, missing in pool: {}",
+             found.size(),
+             missing.size());
+
+  if (not missing.empty()) {
+    grpc::ClientContext fetch_context;
+    fetch_context.set_deadline(std::chrono::system_clock::now()
+                               + FETCH_TIMEOUT);
+    proto::TransactionsResponse fetched;
+    auto status = client_->getTransactions(&fetch_context, fetch, &fetched);
+    if (not status.ok()
+        or static_cast<size_t>(fetched.transactions_size())
+            != missing.size()) {
+      log_->error("can not fetch missing transactions: {}",
+                  status.error_message());
+      return grpc::Status(grpc::StatusCode::NOT_FOUND,
+                          "missing transactions of proposal");
+    }
+    for (size_t i = 0; i < missing.size(); ++i) {
+      found[missing[i]] = factory_.deserialize(fetched.transactions(i));
+    }
+  }
+
+  auto transactions = decltype(std::declval<model::Proposal>().transactions)();
+  transactions.reserve(found.size());
+  for (const auto &tx : found) {
+    transactions.push_back(*tx);
+  }
+
+  model::Proposal proposal(transactions);
+  proposal.height = request->height();
+  emitProposal(std::move(proposal));
+
+  return grpc::Status::OK;
+}
+
+void OrderingGateTransportGrpc::emitProposal(model::Proposal proposal) {
   if (not subscriber_.expired()) {
     subscriber_.lock()->onProposal(std::move(proposal));
   } else {
     log_->error("(onProposal) No subscriber");
   }
+}
 
-  return grpc::Status::OK;
+void OrderingGateTransportGrpc::addToPool(
+    const hash256_t &hash,
+    std::shared_ptr<const model::Transaction> transaction) {
+  auto key = hash.to_string();
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  auto it = pool_.find(key);
+  if (it != pool_.end()) {
+    // resent transaction is refreshed
+    pool_order_.erase(it->second.order);
+    pool_.erase(it);
+  }
+  auto order = pool_order_.insert(pool_order_.end(), key);
+  pool_.emplace(std::move(key), PoolEntry{std::move(transaction), order});
+  while (pool_order_.size() > POOL_CAPACITY) {
+    pool_.erase(pool_order_.front());
+    pool_order_.pop_front();
+  }
 }
 
+constexpr size_t OrderingGateTransportGrpc::DEFAULT_BATCH_SIZE;
+constexpr std::chrono::milliseconds
+    OrderingGateTransportGrpc::DEFAULT_BATCH_DELAY;
+constexpr std::chrono::milliseconds OrderingGateTransportGrpc::DEFAULT_BACKOFF;
+constexpr size_t OrderingGateTransportGrpc::POOL_CAPACITY;
+constexpr std::chrono::milliseconds OrderingGateTransportGrpc::FETCH_TIMEOUT;
+
 OrderingGateTransportGrpc::OrderingGateTransportGrpc(
-    const std::string &server_address)
+    const std::string &server_address,
+    size_t batch_size,
+    std::chrono::milliseconds batch_delay,
+    std::chrono::milliseconds backoff)
     : client_(proto::OrderingServiceTransportGrpc::NewStub(grpc::CreateChannel(
           server_address, grpc::InsecureChannelCredentials()))),
-      log_(logger::log("OrderingGate")) {}
+      log_(logger::log("OrderingGate")),
+      batch_size_(batch_size),
+      batch_delay_(batch_delay),
+      backoff_(backoff),
+      service_state_(std::make_shared<ServiceState>()),
+      flusher_(&OrderingGateTransportGrpc::flushExpired, this) {}
+
+OrderingGateTransportGrpc::~OrderingGateTransportGrpc() {
+  {
+    std::lock_guard<std::mutex> lock(service_state_->batch_mutex);
+    stop_ = true;
+  }
+  service_state_->batch_cv.notify_one();
+  if (flusher_.joinable()) {
+    flusher_.join();
+  }
+}
 
 void OrderingGateTransportGrpc::propagate_transaction(
     std::shared_ptr<const model::Transaction> transaction) {
   log_->info("Propagate tx (on transport)");
+  auto pb_tx = factory_.serialize(*transaction);
+  addToPool(iroha::hash(pb_tx), std::move(transaction));
+
+  std::lock_guard<std::mutex> lock(service_state_->batch_mutex);
+  if (batch_.transactions_size() == 0) {
+    deadline_ = std::chrono::steady_clock::now() + batch_delay_;
+    service_state_->batch_cv.notify_one();
+  }
+  batch_.add_transactions()->Swap(&pb_tx);
+  pending_ = batch_.transactions_size();
+  if (static_cast<size_t>(batch_.transactions_size()) >= batch_size_) {
+    flush();
+  }
+}
+
+void OrderingGateTransportGrpc::flush() {
+  if (batch_.transactions_size() == 0) {
+    return;
+  }
+  if (service_state_->rejected.empty()) {
+    send(std::move(batch_));
+  } else {
+    // keep order of transactions, service is overloaded anyway
+    service_state_->rejected.push_back(std::move(batch_));
+  }
+  batch_.Clear();
+  pending_ = 0;
+}
+
+void OrderingGateTransportGrpc::send(proto::TransactionBatch batch) {
+  log_->info("Send batch of {} transactions", batch.transactions_size());
   auto call = new AsyncClientCall;
 
-  call->response_reader = client_->AsynconTransaction(
-      &call->context, factory_.serialize(*transaction), &cq_);
+  call->response_reader = client_->AsynconBatch(&call->context, batch, &cq_);
 
+  call->on_response = [state = service_state_,
+                       backoff = backoff_,
+                       log = log_,
+                       batch = std::make_shared<proto::TransactionBatch>(
+                           std::move(batch))](const auto &reply,
+                                              const auto &status) {
+    auto deadline = (std::chrono::steady_clock::now() + backoff)
+                        .time_since_epoch()
+                        .count();
+    if (status.ok()) {
+      state->depth = reply.queue_depth();
+      state->depth_deadline = deadline;
+    } else if (status.error_code() == grpc::StatusCode::RESOURCE_EXHAUSTED) {
+      log->warn("Batch rejected: {}", status.error_message());
+      {
+        std::lock_guard<std::mutex> lock(state->batch_mutex);
+        state->backoff_deadline = deadline;
+        // torii has accepted transactions already, they are resent
+        state->rejected.push_back(std::move(*batch));
+      }
+      state->batch_cv.notify_one();
+    }
+  };
   call->response_reader->Finish(&call->reply, &call->status, call);
 }
 
+void OrderingGateTransportGrpc::flushExpired() {
+  auto &state = *service_state_;
+  std::unique_lock<std::mutex> lock(state.batch_mutex);
+  while (not stop_) {
+    auto now = std::chrono::steady_clock::now();
+    auto backoff_deadline = std::chrono::steady_clock::time_point(
+        std::chrono::steady_clock::duration(state.backoff_deadline));
+    if (not state.rejected.empty() and now >= backoff_deadline) {
+      resendRejected();
+    } else if (batch_.transactions_size() != 0 and now >= deadline_) {
+      flush();
+    } else if (batch_.transactions_size() == 0 and state.rejected.empty()) {
+      state.batch_cv.wait(lock);
+    } else {
+      auto wake = state.rejected.empty() ? deadline_ : backoff_deadline;
+      if (batch_.transactions_size() != 0) {
+        wake = std::min(wake, deadline_);
+      }
+      state.batch_cv.wait_until(lock, wake);
+    }
+  }
+  // last chance for rejected transactions, responses are not awaited
+  resendRejected();
+  flush();
+}
+
+void OrderingGateTransportGrpc::resendRejected() {
+  auto rejected = std::move(service_state_->rejected);
+  service_state_->rejected.clear();
+  for (auto &batch : rejected) {
+    send(std::move(batch));
+  }
+}
+
+size_t OrderingGateTransportGrpc::queueDepth() const {
+  // stale depth is not reported, the queue may have drained since
+  auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+  auto depth =
+      now < service_state_->depth_deadline ? service_state_->depth.load() : 0;
+  return depth + pending_;
+}
+
+bool OrderingGateTransportGrpc::overloaded() const {
+  return std::chrono::steady_clock::now().time_since_epoch().count()
+      < service_state_->backoff_deadline;
+}
+
 void OrderingGateTransportGrpc::subscribe(
     std::shared_ptr<iroha::network::OrderingGateNotification> subscriber) {
   log_->info("Subscribe");
@@ -18,6 +18,14 @@
 #define IROHA_ORDERING_GATE_TRANSPORT_GRPC_H
 
 #include <google/protobuf/empty.pb.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include "logger/logger.hpp"
 #include "model/converters/pb_transaction_factory.hpp"
 #include "network/impl/async_grpc_client.hpp"
@@ -29,25 +37,156 @@ namespace iroha {
     class OrderingGateTransportGrpc
         : public iroha::network::OrderingGateTransport,
           public proto::OrderingGateTransportGrpc::Service,
-          private network::AsyncGrpcClient<google::protobuf::Empty> {
+          private network::AsyncGrpcClient<proto::BatchResponse> {
      public:
-      explicit OrderingGateTransportGrpc(const std::string &server_address);
+      /**
+       * @param server_address - address of ordering service
+       * @param batch_size - number of transactions which triggers sending
+       * of the batch
+       * @param batch_delay - maximal time transaction waits in the batch
+       * @param backoff - time ordering service is considered overloaded
+       * after it rejected a batch, and time reported queue depth is valid.
+       * Rejected batches are resent when it expires
+       */
+      explicit OrderingGateTransportGrpc(
+          const std::string &server_address,
+          size_t batch_size = DEFAULT_BATCH_SIZE,
+          std::chrono::milliseconds batch_delay = DEFAULT_BATCH_DELAY,
+          std::chrono::milliseconds backoff = DEFAULT_BACKOFF);
+
+      ~OrderingGateTransportGrpc();
 
       grpc::Status onProposal(::grpc::ServerContext *context,
                               const proto::Proposal *request,
                               ::google::protobuf::Empty *response) override;
 
+      /**
+       * Rebuild proposal from transactions propagated through this gate,
+       * transactions missing in the pool are fetched from ordering service
+       * @return NOT_FOUND if some transactions can not be fetched
+       */
+      grpc::Status onCompactProposal(
+          ::grpc::ServerContext *context,
+          const proto::CompactProposal *request,
+          ::google::protobuf::Empty *response) override;
+
+      /**
+       * Add transaction to the pending batch. Batch is sent to ordering
+       * service when it reaches batch size or batch delay expires
+       */
       void propagate_transaction(
           std::shared_ptr<const model::Transaction> transaction) override;
 
       void subscribe(std::shared_ptr<iroha::network::OrderingGateNotification>
                          subscriber) override;
 
+      /**
+       * @return queue depth reported with the last batch within backoff
+       * plus transactions of the pending batch
+       */
+      size_t queueDepth() const override;
+
+      /**
+       * @return true within backoff after ordering service rejected a batch
+       */
+      bool overloaded() const override;
+
+      static constexpr size_t DEFAULT_BATCH_SIZE = 100;
+      static constexpr std::chrono::milliseconds DEFAULT_BATCH_DELAY{5};
+      static constexpr std::chrono::milliseconds DEFAULT_BACKOFF{100};
+
+      /**
+       * Maximal number of propagated transactions kept for compact proposals
+       */
+      static constexpr size_t POOL_CAPACITY = 10000;
+
+      /**
+       * Deadline of fetching missing transactions from ordering service
+       */
+      static constexpr std::chrono::milliseconds FETCH_TIMEOUT{1000};
+
      private:
+      /**
+       * Pass proposal to the subscriber
+       */
+      void emitProposal(model::Proposal proposal);
+
+      /**
+       * Keep propagated transaction for compact proposals
+       */
+      void addToPool(const hash256_t &hash,
+                     std::shared_ptr<const model::Transaction> transaction);
+
+      /**
+       * Send pending batch if it is not empty, batch mutex must be held.
+       * Batch is queued after rejected ones while they wait for resending
+       */
+      void flush();
+
+      /**
+       * Send batch to ordering service, rejected batch is queued for
+       * resending after backoff
+       */
+      void send(proto::TransactionBatch batch);
+
+      /**
+       * Send all rejected batches, batch mutex must be held
+       */
+      void resendRejected();
+
+      /**
+       * Send batches which outlived batch delay and rejected batches which
+       * outlived backoff until transport is destroyed
+       */
+      void flushExpired();
+
       std::weak_ptr<iroha::network::OrderingGateNotification> subscriber_;
       std::unique_ptr<proto::OrderingServiceTransportGrpc::Stub> client_;
       model::converters::PbTransactionFactory factory_;
       logger::Logger log_;
+
+      size_t batch_size_;
+      std::chrono::milliseconds batch_delay_;
+      proto::TransactionBatch batch_;
+      std::chrono::steady_clock::time_point deadline_;
+      bool stop_{false};
+
+      /**
+       * State of ordering service reported by batch responses, shared with
+       * response handlers of batches in flight. Deadlines are counted
+       * since steady clock epoch
+       */
+      struct ServiceState {
+        std::atomic<size_t> depth{0};
+        std::atomic<std::chrono::steady_clock::rep> depth_deadline{0};
+        std::atomic<std::chrono::steady_clock::rep> backoff_deadline{0};
+
+        /**
+         * Guards pending batch and rejected batches, response handlers
+         * notify the flusher about rejected ones
+         */
+        std::mutex batch_mutex;
+        std::condition_variable batch_cv;
+        std::deque<proto::TransactionBatch> rejected;
+      };
+
+      std::chrono::milliseconds backoff_;
+      std::shared_ptr<ServiceState> service_state_;
+      std::atomic<size_t> pending_{0};
+      std::thread flusher_;
+
+      /**
+       * Propagated transaction with its position in insertion order
+       */
+      struct PoolEntry {
+        std::shared_ptr<const model::Transaction> transaction;
+        std::list<std::string>::iterator order;
+      };
+
+      std::unordered_map<std::string, PoolEntry> pool_;
+      // insertion order, for eviction
+      std::list<std::string> pool_order_;
+      std::mutex pool_mutex_;
     };
 
   }  // namespace ordering
@@ -17,42 +17,206 @@
 
 #include "ordering/impl/ordering_service_impl.hpp"
 
+#include <algorithm>
+#include <iterator>
+
+#include "crypto/hash.hpp"
+
 namespace iroha {
   namespace ordering {
+    constexpr std::chrono::milliseconds OrderingServiceImpl::DEDUP_WINDOW;
+    constexpr size_t OrderingServiceImpl::DEDUP_BUCKETS;
+    constexpr size_t OrderingServiceImpl::MIN_DELAY_DIVISOR;
+    constexpr size_t OrderingServiceImpl::MAX_PUBLISHED;
+    constexpr size_t OrderingServiceImpl::DEFAULT_MAX_QUEUE_SIZE;
+
     OrderingServiceImpl::OrderingServiceImpl(
         std::shared_ptr<ametsuchi::PeerQuery> wsv,
         size_t max_size,
         size_t delay_milliseconds,
-        std::shared_ptr<network::OrderingServiceTransport> transport)
-        : wsv_(wsv),
-          max_size_(max_size),
-          delay_milliseconds_(delay_milliseconds),
+        std::shared_ptr<network::OrderingServiceTransport> transport,
+        std::shared_ptr<TimerWheel> timer_wheel,
+        size_t max_queue_size,
+        size_t partitions,
+        const std::vector<LaneConfig> &lanes,
+        std::shared_ptr<OrderingWal> wal,
+        std::shared_ptr<ametsuchi::BlockQuery> block_query)
+        : timer_wheel_(std::move(timer_wheel)),
+          wsv_(wsv),
+          queue_(lanes, partitions),
+          filter_(DEDUP_WINDOW, DEDUP_BUCKETS),
+          max_queue_size_(max_queue_size),
+          controller_({1,
+                       max_size,
+                       std::chrono::milliseconds(std::max<size_t>(
+                           delay_milliseconds / MIN_DELAY_DIVISOR, 1)),
+                       std::chrono::milliseconds(delay_milliseconds)}),
           transport_(transport),
-          proposal_height(2) {
+          wal_(std::move(wal)),
+          proposal_height(2),
+          log_(logger::log("OrderingService")) {
+      if (wal_) {
+        // transaction may be committed while the node was down, or its
+        // removal may be lost on crash, ledger has the last word
+        std::vector<hash256_t> committed;
+        // recovered transactions are in wal already
+        for (const auto &tx : wal_->recovered()) {
+          auto hash = iroha::hash(tx);
+          if (block_query
+              and block_query->getTxByHashSync(hash.to_string())) {
+            filter_.commit(hash);
+            committed.push_back(hash);
+            continue;
+          }
+          if (filter_.insert(hash)) {
+            queue_.push(tx);
+          }
+        }
+        if (not committed.empty()) {
+          wal_->remove(committed);
+        }
+      }
       updateTimer();
     }
 
     void OrderingServiceImpl::onTransaction(
         const model::Transaction &transaction) {
+      // checked before dedup, so the dropped transaction may be resent
+      if (queueFull()) {
+        ++overflowed_;
+        return;
+      }
+      auto hash = iroha::hash(transaction);
+      if (not filter_.insert(hash)) {
+        return;
+      }
+      if (wal_) {
+        wal_->append(hash, transaction);
+      }
       queue_.push(transaction);
 
-      if (queue_.unsafe_size() >= max_size_) {
-        handle.unsubscribe();
-        updateTimer();
+      // small proposal size under light load must not cut a proposal
+      // for every transaction
+      auto since_last = std::chrono::steady_clock::now()
+          - std::chrono::steady_clock::time_point(
+                std::chrono::steady_clock::duration(last_proposal_));
+      if (queue_.size() < controller_.proposalSize()) {
+        return;
+      }
+      // proposal is generated on the wheel thread only and published
+      // without the lock, so the caller is not blocked by publishing
+      auto delay = std::max<std::chrono::milliseconds>(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              controller_.bounds().min_delay - since_last),
+          std::chrono::milliseconds::zero());
+      std::lock_guard<std::mutex> lock(timer_mutex_);
+      if (stopped_) {
+        return;
       }
+      handle_.cancel();
+      handle_ =
+          timer_wheel_->schedule(delay, [this] { this->updateTimer(); });
     }
 
-    void OrderingServiceImpl::generateProposal() {
-      auto txs = decltype(std::declval<model::Proposal>().transactions)();
-      for (model::Transaction tx;
-           txs.size() < max_size_ and queue_.try_pop(tx);) {
-        txs.push_back(std::move(tx));
+    size_t OrderingServiceImpl::droppedDuplicates() const {
+      return filter_.duplicates();
+    }
+
+    size_t OrderingServiceImpl::queueDepth() const {
+      return queue_.size();
+    }
+
+    bool OrderingServiceImpl::queueFull() const {
+      return queue_.size() >= max_queue_size_;
+    }
+
+    size_t OrderingServiceImpl::droppedOverflow() const {
+      return overflowed_;
+    }
+
+    std::vector<LaneStats> OrderingServiceImpl::laneStats() const {
+      return queue_.stats();
+    }
+
+    void OrderingServiceImpl::onProposalValidated(uint64_t height) {
+      std::lock_guard<std::mutex> lock(published_mutex_);
+      auto it = published_.find(height);
+      if (it == published_.end()) {
+        return;
       }
+      controller_.onValidated(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::steady_clock::now() - it->second.time),
+          it->second.transactions);
+    }
+
+    void OrderingServiceImpl::onCommit(const model::Block &block) {
+      for (const auto &hash : iroha::hash(block.transactions)) {
+        filter_.commit(hash);
+      }
+      auto height = block.height;
+      std::lock_guard<std::mutex> lock(published_mutex_);
+      auto it = published_.find(height);
+      if (it != published_.end()) {
+        controller_.onCommitted(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - it->second.time));
+      }
+      // proposals up to the committed height will not be committed anymore
+      forgetPublished(published_.begin(), published_.upper_bound(height));
+      logMetrics();
+    }
+
+    ProposalMetrics OrderingServiceImpl::proposalMetrics() const {
+      return controller_.metrics();
+    }
+
+    void OrderingServiceImpl::generateProposal() {
+      std::unique_lock<std::mutex> lock(timer_mutex_);
+      auto proposal = collectProposal();
+      lock.unlock();
+      publishProposal(std::move(proposal));
+    }
+
+    model::Proposal OrderingServiceImpl::collectProposal() {
+      controller_.onQueueDepth(queue_.size());
+      auto txs = queue_.pop(controller_.proposalSize());
 
       model::Proposal proposal(txs);
       proposal.height = proposal_height++;
+      last_proposal_ =
+          std::chrono::steady_clock::now().time_since_epoch().count();
+      Published published{
+          std::chrono::steady_clock::now(), txs.size(), iroha::hash(txs)};
+      {
+        std::lock_guard<std::mutex> lock(published_mutex_);
+        published_[proposal.height] = std::move(published);
+        // bound the history if blocks are not committed from these proposals
+        if (published_.size() > MAX_PUBLISHED) {
+          forgetPublished(
+              published_.begin(),
+              std::next(published_.begin(), published_.size() - MAX_PUBLISHED));
+        }
+      }
+      return proposal;
+    }
 
-      publishProposal(std::move(proposal));
+    void OrderingServiceImpl::forgetPublished(
+        std::map<uint64_t, Published>::iterator begin,
+        std::map<uint64_t, Published>::iterator end) {
+      std::vector<hash256_t> hashes;
+      for (auto it = begin; it != end; ++it) {
+        hashes.insert(
+            hashes.end(), it->second.hashes.begin(), it->second.hashes.end());
+      }
+      // committed hashes are not pending anymore and stay in the filter
+      for (const auto &hash : hashes) {
+        filter_.release(hash);
+      }
+      if (wal_) {
+        wal_->remove(hashes);
+      }
+      published_.erase(begin, end);
     }
 
     void OrderingServiceImpl::publishProposal(model::Proposal &&proposal) {
@@ -66,15 +230,63 @@ namespace iroha {
     }
 
     void OrderingServiceImpl::updateTimer() {
-      if (not queue_.empty()) {
-        this->generateProposal();
+      nonstd::optional<model::Proposal> proposal;
+      {
+        std::lock_guard<std::mutex> lock(timer_mutex_);
+        if (stopped_) {
+          return;
+        }
+        if (queue_.size() > 0) {
+          proposal.emplace(collectProposal());
+        }
+        // full proposal left in the queue is not held for the whole delay
+        auto delay = queue_.size() >= controller_.proposalSize()
+            ? controller_.bounds().min_delay
+            : controller_.proposalDelay();
+        // task scheduled by receiver while this one waited for the lock
+        // is replaced, so only one timer chain is alive
+        handle_.cancel();
+        handle_ =
+            timer_wheel_->schedule(delay, [this] { this->updateTimer(); });
+      }
+      // tasks of the wheel run one by one, so proposals are published
+      // in order of their heights
+      if (proposal) {
+        publishProposal(std::move(*proposal));
       }
-      timer = rxcpp::observable<>::timer(
-          std::chrono::milliseconds(delay_milliseconds_));
-      handle = timer.subscribe_on(rxcpp::observe_on_new_thread())
-                   .subscribe([this](auto) { this->updateTimer(); });
     }
 
-    OrderingServiceImpl::~OrderingServiceImpl() { handle.unsubscribe(); }
+    void OrderingServiceImpl::logMetrics() const {
+      auto metrics = proposalMetrics();
+      log_->info("proposal size {}, delay {} ms, queue depth {:.1f}, "
+                 "validation {} us per tx, commit latency {} ms, "
+                 "dropped duplicates {}, overflow {}",
+                 metrics.proposal_size,
+                 metrics.proposal_delay.count(),
+                 metrics.queue_depth,
+                 metrics.validation_per_tx.count(),
+                 metrics.commit_latency.count(),
+                 droppedDuplicates(),
+                 droppedOverflow());
+      for (const auto &lane : laneStats()) {
+        log_->info("lane {}: queued {}, delay p50 {} ms, p99 {} ms of {} "
+                   "transactions",
+                   lane.name,
+                   lane.queued,
+                   lane.delays.percentile(0.5).count(),
+                   lane.delays.percentile(0.99).count(),
+                   lane.delays.count);
+      }
+    }
+
+    OrderingServiceImpl::~OrderingServiceImpl() {
+      {
+        std::lock_guard<std::mutex> lock(timer_mutex_);
+        stopped_ = true;
+      }
+      // handle_ is not reassigned after stop, task waiting for the lock
+      // returns without rescheduling
+      timer_wheel_->cancelAndWait(handle_);
+    }
   }  // namespace ordering
 }  // namespace iroha
@@ -18,22 +18,32 @@
 #ifndef IROHA_ORDERING_SERVICE_IMPL_HPP
 #define IROHA_ORDERING_SERVICE_IMPL_HPP
 
-#include <tbb/concurrent_queue.h>
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <nonstd/optional.hpp>
 #include <unordered_map>
 
 #include "network/impl/async_grpc_client.hpp"
 #include "network/ordering_service.hpp"
 #include "network/ordering_service_transport.hpp"
 
+#include "ametsuchi/block_query.hpp"
 #include "ametsuchi/peer_query.hpp"
 #include "ordering.grpc.pb.h"
 
-#include <rxcpp/rx.hpp>
+#include "logger/logger.hpp"
 #include "model/converters/pb_transaction_factory.hpp"
+#include "model/block.hpp"
 #include "model/proposal.hpp"
 #include "network/impl/async_grpc_client.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/ordering_wal.hpp"
+#include "ordering/impl/priority_lanes.hpp"
+#include "ordering/impl/proposal_controller.hpp"
+#include "ordering/impl/transaction_filter.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
   namespace ordering {
@@ -42,9 +52,22 @@ namespace iroha {
      * OrderingService implementation with gRPC synchronous server
      * Allows receiving transactions concurrently from multiple peers by using
      * concurrent queue
-     * Sends proposal by given timer interval and proposal size
-     * @param delay_milliseconds timer delay
-     * @param max_size proposal size
+     * Sends proposal by given timer interval and proposal size, both are
+     * tuned by ProposalController from observed load and latency
+     * @param delay_milliseconds maximal timer delay, minimal one is
+     * delay_milliseconds / MIN_DELAY_DIVISOR
+     * @param max_size maximal proposal size
+     * @param timer_wheel shared timer which drives proposal generation
+     * @param max_queue_size high-water mark of the queue, transactions over
+     * it are dropped
+     * @param partitions number of queue partitions transactions are routed
+     * to by creator account
+     * @param lanes weighted lanes of the queue for listed accounts and
+     * domains, others go to the default lane
+     * @param wal optional write-ahead log of queued transactions, its
+     * recovered transactions are queued on creation
+     * @param block_query optional ledger, recovered transactions which are
+     * committed to it are removed from wal instead of being queued
      */
     class OrderingServiceImpl : public network::OrderingService {
      public:
@@ -52,15 +75,79 @@ namespace iroha {
           std::shared_ptr<ametsuchi::PeerQuery> wsv,
           size_t max_size,
           size_t delay_milliseconds,
-          std::shared_ptr<network::OrderingServiceTransport> transport);
+          std::shared_ptr<network::OrderingServiceTransport> transport,
+          std::shared_ptr<TimerWheel> timer_wheel,
+          size_t max_queue_size = DEFAULT_MAX_QUEUE_SIZE,
+          size_t partitions = 1,
+          const std::vector<LaneConfig> &lanes = {},
+          std::shared_ptr<OrderingWal> wal = nullptr,
+          std::shared_ptr<ametsuchi::BlockQuery> block_query = nullptr);
 
       /**
        * Process transaction received from network
-       * Enqueues transaction and publishes corresponding event
+       * Enqueues transaction and publishes corresponding event,
+       * transaction seen within dedup window or arrived to the full queue
+       * is dropped
        * @param transaction
        */
       void onTransaction(const model::Transaction &transaction) override;
 
+      size_t queueDepth() const override;
+
+      bool queueFull() const override;
+
+      /**
+       * @return number of transactions dropped because the queue was full
+       */
+      size_t droppedOverflow() const;
+
+      /**
+       * @return queue state and queueing delays of every lane
+       */
+      std::vector<LaneStats> laneStats() const;
+
+      /**
+       * @return number of dropped duplicate transactions
+       */
+      size_t droppedDuplicates() const;
+
+      /**
+       * Report that peer validated proposal published by this service
+       * @param height - height of the proposal
+       */
+      void onProposalValidated(uint64_t height);
+
+      /**
+       * Report commit of the block created from proposal of this service
+       * Transactions of the block are remembered within dedup window,
+       * other transactions of proposals up to its height are forgotten
+       * and may be received again
+       * Proposal and lane metrics are logged on every commit
+       * @param block - committed block
+       */
+      void onCommit(const model::Block &block);
+
+      /**
+       * @return current proposal size and delay with their inputs
+       */
+      ProposalMetrics proposalMetrics() const;
+
+      static constexpr size_t MIN_DELAY_DIVISOR = 10;
+
+      /**
+       * Maximal number of proposals waiting for commit
+       */
+      static constexpr size_t MAX_PUBLISHED = 16;
+
+      static constexpr size_t DEFAULT_MAX_QUEUE_SIZE = 10000;
+
+      /**
+       * Time a committed transaction hash is remembered, hashes of queued
+       * and proposed transactions are kept until commit
+       */
+      static constexpr std::chrono::milliseconds DEDUP_WINDOW{5 * 60 * 1000};
+      static constexpr size_t DEDUP_BUCKETS = 10;
+
       ~OrderingServiceImpl() override;
 
      protected:
@@ -77,32 +164,85 @@ namespace iroha {
        */
       void generateProposal() override;
 
+      /**
+       * Take transactions of the next proposal from queue and remember
+       * the proposal until commit, timer_mutex_ must be held
+       * @return proposal to publish after timer_mutex_ is released
+       */
+      model::Proposal collectProposal();
+
       /**
        * Method update peers for sending proposal
        */
 
       /**
-       * Update the timer to be called after delay_milliseconds_
+       * Generate proposal if the queue is not empty and update the timer to
+       * be called after the delay chosen by controller
        */
       void updateTimer();
 
-      rxcpp::observable<long> timer;
-      rxcpp::composite_subscription handle;
+      /**
+       * Log proposal size and delay with their inputs, drop counters and
+       * queueing delays of lanes
+       */
+      void logMetrics() const;
+
+      std::shared_ptr<TimerWheel> timer_wheel_;
+
+      /**
+       * Guards timer handle, its rescheduling and proposal collection,
+       * which are done both by the wheel and by transaction receivers.
+       * Proposals are published without the lock
+       */
+      std::mutex timer_mutex_;
+      TimerWheel::Handle handle_;
+      bool stopped_{false};
       std::shared_ptr<ametsuchi::PeerQuery> wsv_;
 
-      tbb::concurrent_queue<model::Transaction> queue_;
+      PriorityLanes queue_;
+
+      TransactionFilter filter_;
+
+      const size_t max_queue_size_;
+      std::atomic<size_t> overflowed_{0};
+
+      /**
+       * Chooses proposal size and delay between proposals
+       */
+      ProposalController controller_;
+
+      struct Published {
+        std::chrono::steady_clock::time_point time;
+        size_t transactions;
+        // released from dedup filter and wal when proposal is done
+        std::vector<hash256_t> hashes;
+      };
+
+      /**
+       * Drop proposals from history, their uncommitted transactions are
+       * released from dedup filter and removed from wal,
+       * published_mutex_ must be held
+       */
+      void forgetPublished(std::map<uint64_t, Published>::iterator begin,
+                           std::map<uint64_t, Published>::iterator end);
 
       /**
-       * max number of txs in proposal
+       * Proposals waiting for commit, by height
        */
-      const size_t max_size_;
+      std::map<uint64_t, Published> published_;
+      std::mutex published_mutex_;
 
       /**
-       *  wait for specified time if queue is empty
+       * Time of the last proposal, since steady clock epoch
        */
-      const size_t delay_milliseconds_;
+      std::atomic<std::chrono::steady_clock::rep> last_proposal_{0};
+
       std::shared_ptr<network::OrderingServiceTransport> transport_;
+      std::shared_ptr<OrderingWal> wal_;
+      // guarded by timer_mutex_
       size_t proposal_height;
+
+      logger::Logger log_;
     };
   }  // namespace ordering
 }  // namespace iroha
@@ -15,11 +15,14 @@
  * limitations under the License.
  */
 #include "ordering/impl/ordering_service_transport_grpc.hpp"
+#include "crypto/hash.hpp"
 
 using namespace iroha::ordering;
 using namespace iroha::model;
 using namespace iroha::network;
 
+constexpr size_t OrderingServiceTransportGrpc::PROPOSAL_HISTORY;
+
 void OrderingServiceTransportGrpc::subscribe(
     std::shared_ptr<OrderingServiceNotification> subscriber) {
   subscriber_ = subscriber;
@@ -38,33 +41,110 @@ grpc::Status OrderingServiceTransportGrpc::onTransaction(
   return ::grpc::Status::OK;
 }
 
-void OrderingServiceTransportGrpc::publishProposal(
+grpc::Status OrderingServiceTransportGrpc::onBatch(
+    ::grpc::ServerContext *context,
+    const proto::TransactionBatch *request,
+    proto::BatchResponse *response) {
+  auto subscriber = subscriber_.lock();
+  if (not subscriber) {
+    log_->error("No subscriber");
+    return ::grpc::Status::OK;
+  }
+  // sender backs off instead of having its transactions dropped one by one
+  if (subscriber->queueFull()) {
+    return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                        "ordering queue is full, queue depth: "
+                            + std::to_string(subscriber->queueDepth()));
+  }
+
+  for (const auto &tx : request->transactions()) {
+    subscriber->onTransaction(*factory_.deserialize(tx));
+  }
+  response->set_queue_depth(subscriber->queueDepth());
+
+  return ::grpc::Status::OK;
+}
+
+grpc::Status OrderingServiceTransportGrpc::getTransactions(
+    ::grpc::ServerContext *context,
+    const proto::TransactionsRequest *request,
+    proto::TransactionsResponse *response) {
+  std::lock_guard<std::mutex> lock(recent_mutex_);
+  for (const auto &hash : request->hashes()) {
+    auto it = recent_.find(hash);
+    if (it == recent_.end()) {
+      return grpc::Status(grpc::StatusCode::NOT_FOUND,
+                          "transaction is not in recent proposals");
+    }
+    *response->add_transactions() = factory_.serialize(it->second);
+  }
+  return grpc::Status::OK;
+}
+
+void OrderingServiceTransportGrpc::publishCompactProposal(
     Proposal &&proposal, const std::vector<std::string> &peers) {
-  std::unordered_map<std::string,
-                     std::unique_ptr<proto::OrderingGateTransportGrpc::Stub>>
-      peers_map;
+  proto::CompactProposal pb_proposal;
+  pb_proposal.set_height(proposal.height);
+
+  auto hashes = iroha::hash(proposal.transactions);
+  std::vector<std::string> keys;
+  keys.reserve(hashes.size());
+  for (const auto &hash : hashes) {
+    keys.push_back(hash.to_string());
+    pb_proposal.add_hashes(keys.back());
+  }
+
+  {
+    // bodies are kept until peers had a chance to fetch them
+    std::lock_guard<std::mutex> lock(recent_mutex_);
+    for (size_t i = 0; i < keys.size(); ++i) {
+      recent_[keys[i]] = proposal.transactions[i];
+    }
+    history_.push_back(std::move(keys));
+    while (history_.size() > PROPOSAL_HISTORY) {
+      for (const auto &key : history_.front()) {
+        recent_.erase(key);
+      }
+      history_.pop_front();
+    }
+  }
+
+  for (const auto &stub : peers_.stubs(peers)) {
+    auto call = new AsyncClientCall;
 
-  for (const auto &peer : peers) {
-    peers_map[peer] = proto::OrderingGateTransportGrpc::NewStub(
-        grpc::CreateChannel(peer, grpc::InsecureChannelCredentials()));
+    call->response_reader =
+        stub->AsynconCompactProposal(&call->context, pb_proposal, &cq_);
+
+    call->response_reader->Finish(&call->reply, &call->status, call);
+  }
+}
+
+void OrderingServiceTransportGrpc::publishProposal(
+    Proposal &&proposal, const std::vector<std::string> &peers) {
+  if (compact_proposals_) {
+    return publishCompactProposal(std::move(proposal), peers);
   }
 
   proto::Proposal pb_proposal;
   pb_proposal.set_height(proposal.height);
+  pb_proposal.mutable_transactions()->Reserve(proposal.transactions.size());
   for (const auto &tx : proposal.transactions) {
-    auto pb_tx = pb_proposal.add_transactions();
-    new (pb_tx) protocol::Transaction(factory_.serialize(tx));
+    auto pb_tx = factory_.serialize(tx);
+    pb_proposal.add_transactions()->Swap(&pb_tx);
   }
 
-  for (const auto &peer : peers_map) {
+  // the same message is sent to every peer through its persistent channel
+  for (const auto &stub : peers_.stubs(peers)) {
     auto call = new AsyncClientCall;
 
     call->response_reader =
-        peer.second->AsynconProposal(&call->context, pb_proposal, &cq_);
+        stub->AsynconProposal(&call->context, pb_proposal, &cq_);
 
     call->response_reader->Finish(&call->reply, &call->status, call);
   }
 }
 
-OrderingServiceTransportGrpc::OrderingServiceTransportGrpc()
-    : log_(logger::testLog("OrderingServiceTransportGrpc")) {}
+OrderingServiceTransportGrpc::OrderingServiceTransportGrpc(
+    bool compact_proposals)
+    : log_(logger::testLog("OrderingServiceTransportGrpc")),
+      compact_proposals_(compact_proposals) {}
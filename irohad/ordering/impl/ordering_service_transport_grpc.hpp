@@ -18,12 +18,16 @@
 #define IROHA_ORDERING_SERVICE_TRANSPORT_GRPC_HPP
 
 #include <google/protobuf/empty.pb.h>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 #include "block.pb.h"
 #include "logger/logger.hpp"
 #include "ordering.grpc.pb.h"
 
 #include "model/converters/pb_transaction_factory.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/peer_channel_registry.hpp"
 #include "network/ordering_service_transport.hpp"
 
 namespace iroha {
@@ -34,7 +38,13 @@ namespace iroha {
           public proto::OrderingServiceTransportGrpc::Service,
           network::AsyncGrpcClient<google::protobuf::Empty> {
      public:
-      OrderingServiceTransportGrpc();
+      /**
+       * @param compact_proposals - send proposals as transaction hashes,
+       * peers rebuild bodies from their pools and fetch the missing ones
+       * with getTransactions
+       */
+      explicit OrderingServiceTransportGrpc(bool compact_proposals = false);
+
       void subscribe(
           std::shared_ptr<iroha::network::OrderingServiceNotification>
               subscriber) override;
@@ -46,11 +56,53 @@ namespace iroha {
                                  const protocol::Transaction *request,
                                  ::google::protobuf::Empty *response) override;
 
+      /**
+       * Pass every transaction of the batch to the subscriber in order
+       * and report its queue depth afterwards
+       * @return RESOURCE_EXHAUSTED without queueing the batch if the queue
+       * of the subscriber is full
+       */
+      grpc::Status onBatch(::grpc::ServerContext *context,
+                           const proto::TransactionBatch *request,
+                           proto::BatchResponse *response) override;
+
+      /**
+       * Return bodies of transactions from recent proposals
+       * @return NOT_FOUND if any of requested transactions is unknown
+       */
+      grpc::Status getTransactions(
+          ::grpc::ServerContext *context,
+          const proto::TransactionsRequest *request,
+          proto::TransactionsResponse *response) override;
+
       ~OrderingServiceTransportGrpc() = default;
 
+      /**
+       * Number of recent proposals whose transactions are served
+       */
+      static constexpr size_t PROPOSAL_HISTORY = 8;
+
      private:
+      /**
+       * Send proposal with transaction hashes only
+       */
+      void publishCompactProposal(model::Proposal &&proposal,
+                                  const std::vector<std::string> &peers);
+
+      bool compact_proposals_;
+
+      /**
+       * Transactions of recent compact proposals by hash,
+       * grouped by proposal for eviction
+       */
+      std::unordered_map<std::string, model::Transaction> recent_;
+      std::deque<std::vector<std::string>> history_;
+      std::mutex recent_mutex_;
+
       std::weak_ptr<iroha::network::OrderingServiceNotification> subscriber_;
       model::converters::PbTransactionFactory factory_;
+      network::PeerChannelRegistry<proto::OrderingGateTransportGrpc>
+          peers_;
       logger::Logger log_;
     };
 
@@ -0,0 +1,373 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/ordering_wal.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace iroha {
+  namespace ordering {
+
+    namespace {
+      const char TRANSACTION_RECORD = 'T';
+      const char REMOVE_RECORD = 'R';
+      // record size and checksum
+      const size_t HEADER_SIZE = 2 * sizeof(uint32_t);
+      const char *SEGMENT_EXTENSION = ".wal";
+      const size_t SEGMENT_DIGITS = 16;
+      const size_t HASH_SIZE = hash256_t::size();
+
+      uint32_t checksum(const char *data, size_t size) {
+        boost::crc_32_type crc;
+        crc.process_bytes(data, size);
+        return crc.checksum();
+      }
+
+      /**
+       * Write the whole buffer, retrying partial writes
+       * @return false on error
+       */
+      bool writeAll(int fd, const std::string &bytes) {
+        size_t written = 0;
+        while (written < bytes.size()) {
+          auto n = ::write(fd, bytes.data() + written, bytes.size() - written);
+          if (n < 0) {
+            if (errno == EINTR) {
+              continue;
+            }
+            return false;
+          }
+          written += n;
+        }
+        return true;
+      }
+
+      /**
+       * Make creation and deletion of segment files durable
+       */
+      void syncDirectory(const std::string &path) {
+        auto fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd >= 0) {
+          ::fsync(fd);
+          ::close(fd);
+        }
+      }
+    }  // namespace
+
+    constexpr std::chrono::milliseconds OrderingWal::DEFAULT_SYNC_INTERVAL;
+    constexpr size_t OrderingWal::DEFAULT_SEGMENT_SIZE;
+
+    std::unique_ptr<OrderingWal> OrderingWal::create(
+        const std::string &path,
+        std::chrono::milliseconds sync_interval,
+        size_t segment_size) {
+      auto log = logger::log("OrderingWal::create()");
+
+      boost::system::error_code error;
+      boost::filesystem::create_directories(path, error);
+      if (not boost::filesystem::is_directory(path)) {
+        log->error("Cannot create wal dir: {}", path);
+        return nullptr;
+      }
+
+      std::unique_ptr<OrderingWal> wal(
+          new OrderingWal(path, sync_interval, segment_size));
+      if (not wal->replay()) {
+        log->error("Cannot replay wal in {}", path);
+        return nullptr;
+      }
+      wal->syncer_ = std::thread(&OrderingWal::syncLoop, wal.get());
+      return wal;
+    }
+
+    OrderingWal::OrderingWal(std::string path,
+                             std::chrono::milliseconds sync_interval,
+                             size_t segment_size)
+        : path_(std::move(path)),
+          sync_interval_(sync_interval),
+          segment_size_(segment_size),
+          log_(logger::log("OrderingWal")) {}
+
+    OrderingWal::~OrderingWal() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      cv_.notify_one();
+      if (syncer_.joinable()) {
+        syncer_.join();
+      }
+      flush();
+      if (fd_ >= 0) {
+        ::close(fd_);
+      }
+    }
+
+    std::string OrderingWal::segmentPath(uint64_t segment) const {
+      std::ostringstream os;
+      os << std::setw(SEGMENT_DIGITS) << std::setfill('0') << segment
+         << SEGMENT_EXTENSION;
+      return (boost::filesystem::path(path_) / os.str()).string();
+    }
+
+    bool OrderingWal::replay() {
+      std::vector<std::pair<uint64_t, std::string>> files;
+      boost::system::error_code error;
+      for (boost::filesystem::directory_iterator it(path_, error), end;
+           not error and it != end;
+           it.increment(error)) {
+        auto name = it->path().filename().string();
+        if (name.size() != SEGMENT_DIGITS + std::strlen(SEGMENT_EXTENSION)
+            or it->path().extension() != SEGMENT_EXTENSION) {
+          continue;
+        }
+        files.emplace_back(std::stoull(name.substr(0, SEGMENT_DIGITS)),
+                           it->path().string());
+      }
+      if (error) {
+        log_->error("Cannot list {}: {}", path_, error.message());
+        return false;
+      }
+      std::sort(files.begin(), files.end());
+
+      // transaction payloads in order of appending, removed ones are empty
+      std::vector<std::pair<std::string, std::string>> entries;
+      std::unordered_map<std::string, size_t> index;
+      size_t records = 0;
+      for (const auto &file : files) {
+        std::ifstream input(file.second, std::ios::binary);
+        std::string data((std::istreambuf_iterator<char>(input)),
+                         std::istreambuf_iterator<char>());
+        size_t offset = 0;
+        while (offset + HEADER_SIZE <= data.size()) {
+          uint32_t size, crc;
+          std::memcpy(&size, data.data() + offset, sizeof(size));
+          std::memcpy(&crc, data.data() + offset + sizeof(size), sizeof(crc));
+          auto body = data.data() + offset + HEADER_SIZE;
+          // torn or corrupted tail of a segment written before crash
+          if (size == 0 or offset + HEADER_SIZE + size > data.size()
+              or checksum(body, size) != crc) {
+            log_->warn("Truncated record in {} at {}", file.second, offset);
+            break;
+          }
+          offset += HEADER_SIZE + size;
+          ++records;
+
+          auto type = body[0];
+          std::string payload(body + 1, size - 1);
+          if (type == TRANSACTION_RECORD and payload.size() >= HASH_SIZE) {
+            auto key = payload.substr(0, HASH_SIZE);
+            index[key] = entries.size();
+            entries.emplace_back(std::move(key),
+                                 payload.substr(HASH_SIZE));
+          } else if (type == REMOVE_RECORD) {
+            for (size_t i = 0; i + HASH_SIZE <= payload.size();
+                 i += HASH_SIZE) {
+              auto it = index.find(payload.substr(i, HASH_SIZE));
+              if (it != index.end()) {
+                entries[it->second].second.clear();
+                index.erase(it);
+              }
+            }
+          }
+        }
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        active_ = files.empty() ? 0 : files.back().first + 1;
+        segment_live_[active_] = 0;
+        for (const auto &entry : entries) {
+          if (index.find(entry.first) == index.end()) {
+            continue;
+          }
+          protocol::Transaction pb_tx;
+          if (not pb_tx.ParseFromString(entry.second)) {
+            log_->warn("Skip unparsable transaction");
+            continue;
+          }
+          recovered_.push_back(*factory_.deserialize(pb_tx));
+          writeRecord(TRANSACTION_RECORD, entry.first + entry.second);
+          live_[entry.first] = active_;
+          ++segment_live_[active_];
+        }
+        // live transactions are compacted, old segments are not needed
+        for (const auto &file : files) {
+          deletable_.push_back(file.first);
+        }
+      }
+      log_->info("Replayed {} records from {} segments, recovered {}",
+                 records,
+                 files.size(),
+                 recovered_.size());
+
+      flush();
+      return true;
+    }
+
+    std::vector<model::Transaction> OrderingWal::recovered() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return std::move(recovered_);
+    }
+
+    void OrderingWal::writeRecord(char type, const std::string &body) {
+      if (active_size_ >= segment_size_) {
+        ++active_;
+        active_size_ = 0;
+        segment_live_[active_] = 0;
+      }
+      if (buffer_.empty() or buffer_.back().segment != active_) {
+        buffer_.push_back(Chunk{active_, {}});
+      }
+
+      auto &bytes = buffer_.back().bytes;
+      uint32_t size = body.size() + 1;
+      auto offset = bytes.size();
+      bytes.resize(offset + HEADER_SIZE);
+      bytes += type;
+      bytes += body;
+      uint32_t crc = checksum(bytes.data() + offset + HEADER_SIZE, size);
+      std::memcpy(&bytes[offset], &size, sizeof(size));
+      std::memcpy(&bytes[offset + sizeof(size)], &crc, sizeof(crc));
+      active_size_ += HEADER_SIZE + size;
+
+      // remove records refer to the same or earlier segments, so segments
+      // are deleted only from the front
+      while (segment_live_.begin()->first != active_
+             and segment_live_.begin()->second == 0) {
+        deletable_.push_back(segment_live_.begin()->first);
+        segment_live_.erase(segment_live_.begin());
+      }
+    }
+
+    void OrderingWal::append(const hash256_t &hash,
+                             const model::Transaction &transaction) {
+      auto key = hash.to_string();
+      std::string body;
+      factory_.serialize(transaction).AppendToString(&body);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (live_.count(key) != 0) {
+        return;
+      }
+      writeRecord(TRANSACTION_RECORD, key + body);
+      live_[key] = active_;
+      ++segment_live_[active_];
+    }
+
+    void OrderingWal::remove(const std::vector<hash256_t> &hashes) {
+      std::string body;
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto &hash : hashes) {
+        auto key = hash.to_string();
+        auto it = live_.find(key);
+        if (it == live_.end()) {
+          continue;
+        }
+        --segment_live_[it->second];
+        live_.erase(it);
+        body += key;
+      }
+      if (not body.empty()) {
+        writeRecord(REMOVE_RECORD, body);
+      }
+    }
+
+    void OrderingWal::sync() {
+      flush();
+    }
+
+    size_t OrderingWal::size() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return live_.size();
+    }
+
+    size_t OrderingWal::segments() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return segment_live_.size();
+    }
+
+    void OrderingWal::flush() {
+      std::lock_guard<std::mutex> io_lock(io_mutex_);
+      std::vector<Chunk> chunks;
+      std::vector<uint64_t> deletable;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        chunks.swap(buffer_);
+        deletable.swap(deletable_);
+      }
+
+      for (const auto &chunk : chunks) {
+        if (fd_ < 0 or chunk.segment != fd_segment_) {
+          if (fd_ >= 0) {
+            ::fdatasync(fd_);
+            ::close(fd_);
+          }
+          fd_segment_ = chunk.segment;
+          fd_ = ::open(segmentPath(fd_segment_).c_str(),
+                       O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC,
+                       0644);
+          if (fd_ < 0) {
+            log_->error("Cannot open segment {}: {}",
+                        fd_segment_,
+                        std::strerror(errno));
+            continue;
+          }
+          syncDirectory(path_);
+        }
+        if (not writeAll(fd_, chunk.bytes)) {
+          log_->error("Cannot write segment {}: {}",
+                      fd_segment_,
+                      std::strerror(errno));
+        }
+      }
+      if (not chunks.empty() and fd_ >= 0) {
+        ::fdatasync(fd_);
+      }
+
+      for (auto segment : deletable) {
+        if (fd_ >= 0 and segment == fd_segment_) {
+          ::close(fd_);
+          fd_ = -1;
+        }
+        ::unlink(segmentPath(segment).c_str());
+      }
+      if (not deletable.empty()) {
+        syncDirectory(path_);
+      }
+    }
+
+    void OrderingWal::syncLoop() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (not stop_) {
+        cv_.wait_for(lock, sync_interval_);
+        lock.unlock();
+        flush();
+        lock.lock();
+      }
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,179 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_ORDERING_WAL_HPP
+#define IROHA_ORDERING_WAL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types.hpp"
+#include "logger/logger.hpp"
+#include "model/converters/pb_transaction_factory.hpp"
+#include "model/transaction.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Append-only write-ahead log of transactions accepted by ordering
+     * service and not yet proposed and committed.
+     *
+     * Records are appended to a memory buffer and written with one
+     * fdatasync per sync interval, so transactions accepted within the last
+     * interval may be lost on crash. Removal appends a record with hashes
+     * of removed transactions, and a segment file is deleted as soon as all
+     * its transactions are removed. On creation the log is replayed, live
+     * transactions are rewritten to a fresh segment and old segments are
+     * deleted, so replay time is bounded by the live transactions and
+     * removals of the previous run.
+     */
+    class OrderingWal {
+     public:
+      /**
+       * Open log in the directory and replay it
+       * @param path - directory of segment files, created if missing
+       * @param sync_interval - time between batched syncs
+       * @param segment_size - size of segment file after which next
+       * records go to a new segment
+       * @return log, or nullptr if directory can not be used
+       */
+      static std::unique_ptr<OrderingWal> create(
+          const std::string &path,
+          std::chrono::milliseconds sync_interval = DEFAULT_SYNC_INTERVAL,
+          size_t segment_size = DEFAULT_SEGMENT_SIZE);
+
+      /**
+       * Syncs all appended records
+       */
+      ~OrderingWal();
+
+      OrderingWal(const OrderingWal &) = delete;
+      OrderingWal &operator=(const OrderingWal &) = delete;
+
+      /**
+       * Transactions live at the moment of creation, in order of appending.
+       * They stay in the log until removed.
+       * @return recovered transactions, empty on subsequent calls
+       */
+      std::vector<model::Transaction> recovered();
+
+      /**
+       * Log accepted transaction
+       * @param hash - hash of the transaction
+       */
+      void append(const hash256_t &hash, const model::Transaction &transaction);
+
+      /**
+       * Forget transactions, unknown hashes are ignored
+       */
+      void remove(const std::vector<hash256_t> &hashes);
+
+      /**
+       * Write and sync appended records without waiting for the interval
+       */
+      void sync();
+
+      /**
+       * @return number of transactions in the log
+       */
+      size_t size() const;
+
+      /**
+       * @return number of segment files
+       */
+      size_t segments() const;
+
+      static constexpr std::chrono::milliseconds DEFAULT_SYNC_INTERVAL{10};
+      static constexpr size_t DEFAULT_SEGMENT_SIZE = 16 * 1024 * 1024;
+
+     private:
+      OrderingWal(std::string path,
+                  std::chrono::milliseconds sync_interval,
+                  size_t segment_size);
+
+      /**
+       * Read live transactions from existing segments and compact them
+       * into a new one
+       * @return false if segments can not be read
+       */
+      bool replay();
+
+      /**
+       * Append record to the buffer of the active segment,
+       * mutex_ must be held
+       */
+      void writeRecord(char type, const std::string &body);
+
+      /**
+       * Write buffered records to segment files, sync them and delete
+       * segments without live transactions
+       */
+      void flush();
+
+      /**
+       * Flush every sync interval until the log is destroyed
+       */
+      void syncLoop();
+
+      std::string segmentPath(uint64_t segment) const;
+
+      /**
+       * Records of one segment waiting for write
+       */
+      struct Chunk {
+        uint64_t segment;
+        std::string bytes;
+      };
+
+      const std::string path_;
+      const std::chrono::milliseconds sync_interval_;
+      const size_t segment_size_;
+
+      // guarded by mutex_
+      std::vector<Chunk> buffer_;
+      uint64_t active_{0};
+      size_t active_size_{0};
+      std::unordered_map<std::string, uint64_t> live_;
+      std::map<uint64_t, size_t> segment_live_;
+      std::vector<uint64_t> deletable_;
+      bool stop_{false};
+      mutable std::mutex mutex_;
+      std::condition_variable cv_;
+
+      // guarded by io_mutex_
+      int fd_{-1};
+      uint64_t fd_segment_{0};
+      std::mutex io_mutex_;
+
+      std::vector<model::Transaction> recovered_;
+      model::converters::PbTransactionFactory factory_;
+      logger::Logger log_;
+      std::thread syncer_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_WAL_HPP
@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/partitioned_queue.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace ordering {
+
+    PartitionedQueue::PartitionedQueue(size_t partitions)
+        : queues_(std::max<size_t>(partitions, 1)) {}
+
+    void PartitionedQueue::push(const model::Transaction &transaction) {
+      // counted first, so concurrent pop never makes the size negative
+      ++size_;
+      queues_[partitionOf(transaction.creator_account_id, queues_.size())]
+          .push(Entry{transaction, std::chrono::steady_clock::now()});
+    }
+
+    std::vector<model::Transaction> PartitionedQueue::pop(size_t max_size) {
+      std::vector<model::Transaction> result;
+      if (max_size == 0) {
+        return result;
+      }
+      auto now = std::chrono::steady_clock::now();
+      auto start = next_;
+      next_ = (next_ + 1) % queues_.size();
+
+      // stop after a full round over partitions without any transaction
+      size_t empty_in_row = 0;
+      for (auto i = start;
+           result.size() < max_size and empty_in_row < queues_.size();
+           i = (i + 1) % queues_.size()) {
+        Entry entry;
+        if (queues_[i].try_pop(entry)) {
+          delays_.record(now - entry.queued);
+          result.push_back(std::move(entry.transaction));
+          empty_in_row = 0;
+        } else {
+          ++empty_in_row;
+        }
+      }
+      size_ -= result.size();
+      return result;
+    }
+
+    size_t PartitionedQueue::size() const {
+      return size_;
+    }
+
+    size_t PartitionedQueue::partitions() const {
+      return queues_.size();
+    }
+
+    DelayHistogram::Snapshot PartitionedQueue::delays() const {
+      return delays_.snapshot();
+    }
+
+    size_t PartitionedQueue::partitionOf(const std::string &account_id,
+                                         size_t partitions) {
+      // 64-bit FNV-1a
+      uint64_t hash = 14695981039346656037ull;
+      for (unsigned char c : account_id) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+      }
+      return hash % partitions;
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,96 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_PARTITIONED_QUEUE_HPP
+#define IROHA_PARTITIONED_QUEUE_HPP
+
+#include <tbb/concurrent_queue.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "model/transaction.hpp"
+#include "ordering/impl/delay_histogram.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Transaction queue split into partitions by creator account.
+     * Producers of different partitions do not contend with each other,
+     * and all transactions of one account stay in one FIFO partition.
+     * Partitions are merged by a single consumer in deterministic
+     * round-robin order, so per-account order is kept in proposals.
+     * Time transactions spent in the queue is collected in a histogram.
+     */
+    class PartitionedQueue {
+     public:
+      /**
+       * @param partitions - number of partitions, at least one
+       */
+      explicit PartitionedQueue(size_t partitions);
+
+      /**
+       * Append transaction to the partition of its creator
+       */
+      void push(const model::Transaction &transaction);
+
+      /**
+       * Take transactions from partitions one by one in partition order,
+       * starting from the partition next to the one the previous merge
+       * started from. Must not be called concurrently.
+       * @param max_size - maximal number of transactions to take
+       * @return merged transactions
+       */
+      std::vector<model::Transaction> pop(size_t max_size);
+
+      /**
+       * @return number of queued transactions
+       */
+      size_t size() const;
+
+      size_t partitions() const;
+
+      /**
+       * @return time taken transactions spent in the queue
+       */
+      DelayHistogram::Snapshot delays() const;
+
+      /**
+       * Stable across processes and platforms, so every peer routes
+       * the account to the same partition
+       * @return partition of transactions created by the account
+       */
+      static size_t partitionOf(const std::string &account_id,
+                                size_t partitions);
+
+     private:
+      struct Entry {
+        model::Transaction transaction;
+        std::chrono::steady_clock::time_point queued;
+      };
+
+      std::vector<tbb::concurrent_queue<Entry>> queues_;
+      DelayHistogram delays_;
+      std::atomic<size_t> size_{0};
+      size_t next_{0};
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PARTITIONED_QUEUE_HPP
@@ -0,0 +1,131 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/priority_lanes.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace iroha {
+  namespace ordering {
+
+    constexpr const char *PriorityLanes::DEFAULT_LANE;
+    constexpr size_t PriorityLanes::DEFAULT_WEIGHT;
+
+    PriorityLanes::Lane::Lane(std::string name,
+                              size_t weight,
+                              size_t partitions)
+        : name(std::move(name)),
+          weight(std::max<size_t>(weight, 1)),
+          queue(partitions) {}
+
+    PriorityLanes::PriorityLanes(const std::vector<LaneConfig> &lanes,
+                                 size_t partitions) {
+      for (const auto &config : lanes) {
+        lanes_.push_back(
+            std::make_unique<Lane>(config.name, config.weight, partitions));
+        auto lane = lanes_.back().get();
+        // the first lane listing an account or domain takes it
+        for (const auto &account : config.accounts) {
+          by_account_.emplace(account, lane);
+        }
+        for (const auto &domain : config.domains) {
+          by_domain_.emplace(domain, lane);
+        }
+      }
+      lanes_.push_back(
+          std::make_unique<Lane>(DEFAULT_LANE, DEFAULT_WEIGHT, partitions));
+    }
+
+    PriorityLanes::Lane &PriorityLanes::laneOf(
+        const std::string &account_id) {
+      auto account = by_account_.find(account_id);
+      if (account != by_account_.end()) {
+        return *account->second;
+      }
+      auto at = account_id.find('@');
+      if (at != std::string::npos) {
+        auto domain = by_domain_.find(account_id.substr(at + 1));
+        if (domain != by_domain_.end()) {
+          return *domain->second;
+        }
+      }
+      return *lanes_.back();
+    }
+
+    void PriorityLanes::push(const model::Transaction &transaction) {
+      laneOf(transaction.creator_account_id).queue.push(transaction);
+    }
+
+    std::vector<model::Transaction> PriorityLanes::pop(size_t max_size) {
+      std::vector<model::Transaction> result;
+      while (result.size() < max_size) {
+        // space is shared among lanes which have transactions
+        size_t active_weight = 0;
+        for (const auto &lane : lanes_) {
+          if (lane->queue.size() > 0) {
+            active_weight += lane->weight;
+          }
+        }
+        if (active_weight == 0) {
+          break;
+        }
+
+        auto taken = result.size();
+        auto remaining = max_size - taken;
+        for (const auto &lane : lanes_) {
+          if (result.size() == max_size) {
+            break;
+          }
+          if (lane->queue.size() == 0) {
+            continue;
+          }
+          // rounded up, so every lane with transactions makes progress
+          auto share =
+              (remaining * lane->weight + active_weight - 1) / active_weight;
+          auto txs = lane->queue.pop(
+              std::min(share, max_size - result.size()));
+          std::move(txs.begin(), txs.end(), std::back_inserter(result));
+        }
+        if (result.size() == taken) {
+          break;
+        }
+      }
+      return result;
+    }
+
+    size_t PriorityLanes::size() const {
+      size_t size = 0;
+      for (const auto &lane : lanes_) {
+        size += lane->queue.size();
+      }
+      return size;
+    }
+
+    std::vector<LaneStats> PriorityLanes::stats() const {
+      std::vector<LaneStats> stats;
+      for (const auto &lane : lanes_) {
+        stats.push_back(LaneStats{lane->name,
+                                  lane->weight,
+                                  lane->queue.size(),
+                                  lane->queue.delays()});
+      }
+      return stats;
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
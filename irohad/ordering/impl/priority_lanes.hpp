@@ -0,0 +1,114 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_PRIORITY_LANES_HPP
+#define IROHA_PRIORITY_LANES_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ordering/impl/partitioned_queue.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Configuration of a lane of ordering queue
+     */
+    struct LaneConfig {
+      std::string name;
+      // share of proposal relative to other lanes
+      size_t weight;
+      // creators routed to the lane by account id
+      std::vector<std::string> accounts;
+      // creators routed to the lane by domain, if account is not listed
+      std::vector<std::string> domains;
+    };
+
+    /**
+     * State of a lane
+     */
+    struct LaneStats {
+      std::string name;
+      size_t weight;
+      size_t queued;
+      // time spent in the lane by transactions taken to proposals
+      DelayHistogram::Snapshot delays;
+    };
+
+    /**
+     * Ordering queue split into weighted lanes by creator account or domain.
+     * Proposals drain lanes in weighted fair manner: each round every lane
+     * with transactions gets a share of the remaining space proportional
+     * to its weight, space left by lanes which ran out of transactions goes
+     * to the next round. Lanes come
+     * in configured order in proposal, followed by the default lane for
+     * unlisted creators. An account is routed to exactly one lane, so its
+     * transactions keep their order.
+     */
+    class PriorityLanes {
+     public:
+      /**
+       * @param lanes - configured lanes, zero weight is treated as one
+       * @param partitions - number of partitions of every lane
+       */
+      PriorityLanes(const std::vector<LaneConfig> &lanes, size_t partitions);
+
+      void push(const model::Transaction &transaction);
+
+      /**
+       * Must not be called concurrently
+       * @param max_size - maximal number of transactions to take
+       * @return transactions from all lanes
+       */
+      std::vector<model::Transaction> pop(size_t max_size);
+
+      /**
+       * @return number of queued transactions in all lanes
+       */
+      size_t size() const;
+
+      std::vector<LaneStats> stats() const;
+
+      static constexpr const char *DEFAULT_LANE = "default";
+      static constexpr size_t DEFAULT_WEIGHT = 1;
+
+     private:
+      struct Lane {
+        Lane(std::string name, size_t weight, size_t partitions);
+
+        std::string name;
+        size_t weight;
+        PartitionedQueue queue;
+      };
+
+      /**
+       * @return lane of transactions created by the account
+       */
+      Lane &laneOf(const std::string &account_id);
+
+      std::vector<std::unique_ptr<Lane>> lanes_;
+      std::unordered_map<std::string, Lane *> by_account_;
+      std::unordered_map<std::string, Lane *> by_domain_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PRIORITY_LANES_HPP
@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/proposal_controller.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace iroha {
+  namespace ordering {
+
+    namespace {
+      double smooth(double current, double observed) {
+        return current + ProposalController::SMOOTHING * (observed - current);
+      }
+    }  // namespace
+
+    constexpr double ProposalController::SMOOTHING;
+
+    ProposalController::ProposalController(Bounds bounds)
+        : bounds_(bounds), queue_depth_(bounds.max_size) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      decide();
+      metrics_.adjustments = 0;
+    }
+
+    void ProposalController::onQueueDepth(size_t depth) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_depth_ = smooth(queue_depth_, depth);
+      decide();
+    }
+
+    void ProposalController::onValidated(std::chrono::milliseconds duration,
+                                         size_t transactions) {
+      if (transactions == 0) {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      double per_tx =
+          std::chrono::duration<double, std::micro>(duration).count()
+          / transactions;
+      validation_per_tx_us_ = validation_per_tx_us_ == 0
+          ? per_tx
+          : smooth(validation_per_tx_us_, per_tx);
+      decide();
+    }
+
+    void ProposalController::onCommitted(std::chrono::milliseconds latency) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      commit_latency_ms_ = commit_latency_ms_ == 0
+          ? latency.count()
+          : smooth(commit_latency_ms_, latency.count());
+      decide();
+    }
+
+    size_t ProposalController::proposalSize() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return metrics_.proposal_size;
+    }
+
+    std::chrono::milliseconds ProposalController::proposalDelay() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return metrics_.proposal_delay;
+    }
+
+    ProposalMetrics ProposalController::metrics() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return metrics_;
+    }
+
+    const ProposalController::Bounds &ProposalController::bounds() const {
+      return bounds_;
+    }
+
+    void ProposalController::decide() {
+      auto size = static_cast<size_t>(std::lround(queue_depth_));
+      if (validation_per_tx_us_ > 0) {
+        // validation of the whole proposal should fit into maximal delay
+        auto budget = std::chrono::duration<double, std::micro>(
+                          bounds_.max_delay)
+                          .count();
+        size = std::min(size, static_cast<size_t>(budget
+                                                  / validation_per_tx_us_));
+      }
+      size = std::max(bounds_.min_size, std::min(bounds_.max_size, size));
+
+      auto delay = bounds_.max_delay;
+      if (commit_latency_ms_ > 0) {
+        delay = std::max(
+            bounds_.min_delay,
+            std::min(bounds_.max_delay,
+                     std::chrono::milliseconds(
+                         static_cast<long long>(commit_latency_ms_))));
+      }
+
+      if (size != metrics_.proposal_size or delay != metrics_.proposal_delay) {
+        ++metrics_.adjustments;
+      }
+      metrics_.proposal_size = size;
+      metrics_.proposal_delay = delay;
+      metrics_.queue_depth = queue_depth_;
+      metrics_.validation_per_tx = std::chrono::microseconds(
+          static_cast<long long>(validation_per_tx_us_));
+      metrics_.commit_latency = std::chrono::milliseconds(
+          static_cast<long long>(commit_latency_ms_));
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
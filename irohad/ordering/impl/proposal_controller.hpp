@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_PROPOSAL_CONTROLLER_HPP
+#define IROHA_PROPOSAL_CONTROLLER_HPP
+
+#include <chrono>
+#include <mutex>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Decisions and observations of proposal controller
+     */
+    struct ProposalMetrics {
+      // current proposal size limit
+      size_t proposal_size = 0;
+      // current delay between proposals
+      std::chrono::milliseconds proposal_delay{0};
+      // smoothed queue depth at proposal generation
+      double queue_depth = 0;
+      // smoothed validation time of one transaction
+      std::chrono::microseconds validation_per_tx{0};
+      // smoothed time from proposal to commit of its block
+      std::chrono::milliseconds commit_latency{0};
+      // number of changed decisions
+      size_t adjustments = 0;
+    };
+
+    /**
+     * Tunes proposal size and delay within bounds.
+     *
+     * Size follows the queue depth, so bursts are drained in large proposals
+     * and light load is not held back, but it is capped so that validation
+     * of a proposal fits into the maximal delay. Delay follows the commit
+     * latency: a proposal is not cut before the previous one could be
+     * committed, and is not held longer than that under light load.
+     */
+    class ProposalController {
+     public:
+      struct Bounds {
+        size_t min_size;
+        size_t max_size;
+        std::chrono::milliseconds min_delay;
+        std::chrono::milliseconds max_delay;
+      };
+
+      /**
+       * Until the first observations proposal size and delay are maximal
+       * @param bounds - limits of proposal size and delay
+       */
+      explicit ProposalController(Bounds bounds);
+
+      /**
+       * Observe number of queued transactions when proposal is generated
+       */
+      void onQueueDepth(size_t depth);
+
+      /**
+       * Observe time from publishing proposal till it was validated
+       * @param duration - time spent for proposal
+       * @param transactions - number of transactions in the proposal
+       */
+      void onValidated(std::chrono::milliseconds duration,
+                       size_t transactions);
+
+      /**
+       * Observe time from publishing proposal till its block was committed
+       */
+      void onCommitted(std::chrono::milliseconds latency);
+
+      /**
+       * @return maximal number of transactions in the next proposal
+       */
+      size_t proposalSize() const;
+
+      /**
+       * @return time to wait before the next proposal
+       */
+      std::chrono::milliseconds proposalDelay() const;
+
+      ProposalMetrics metrics() const;
+
+      /**
+       * @return limits of proposal size and delay
+       */
+      const Bounds &bounds() const;
+
+      /**
+       * Weight of a new observation in smoothed values
+       */
+      static constexpr double SMOOTHING = 0.25;
+
+     private:
+      /**
+       * Recalculate decisions from smoothed observations, mutex_ must be held
+       */
+      void decide();
+
+      const Bounds bounds_;
+      double queue_depth_;
+      double validation_per_tx_us_{0};
+      double commit_latency_ms_{0};
+      ProposalMetrics metrics_;
+      mutable std::mutex mutex_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_CONTROLLER_HPP
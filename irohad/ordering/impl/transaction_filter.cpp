@@ -0,0 +1,108 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/transaction_filter.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace ordering {
+
+    constexpr size_t TransactionFilter::STRIPES;
+
+    TransactionFilter::TransactionFilter(std::chrono::milliseconds window,
+                                         size_t buckets)
+        : start_(Clock::now()),
+          bucket_duration_(std::max<std::chrono::milliseconds::rep>(
+              window.count() / std::max<size_t>(buckets, 1), 1)),
+          buckets_(std::max<size_t>(buckets, 1)) {
+      for (auto &stripe : stripes_) {
+        stripe.buckets.emplace_back();
+      }
+    }
+
+    bool TransactionFilter::insert(const hash256_t &hash) {
+      auto key = hash.to_string();
+      auto &stripe = this->stripe(hash);
+
+      std::lock_guard<std::mutex> lock(stripe.mutex);
+      rotate(stripe, epoch());
+      auto seen = stripe.pending.count(key) != 0
+          or std::any_of(
+                 stripe.buckets.begin(),
+                 stripe.buckets.end(),
+                 [&key](const auto &bucket) { return bucket.count(key) != 0; });
+      if (seen) {
+        ++duplicates_;
+        return false;
+      }
+      stripe.pending.insert(std::move(key));
+      ++accepted_;
+      return true;
+    }
+
+    void TransactionFilter::commit(const hash256_t &hash) {
+      auto key = hash.to_string();
+      auto &stripe = this->stripe(hash);
+
+      std::lock_guard<std::mutex> lock(stripe.mutex);
+      rotate(stripe, epoch());
+      stripe.pending.erase(key);
+      stripe.buckets.back().insert(std::move(key));
+    }
+
+    void TransactionFilter::release(const hash256_t &hash) {
+      auto &stripe = this->stripe(hash);
+
+      std::lock_guard<std::mutex> lock(stripe.mutex);
+      stripe.pending.erase(hash.to_string());
+    }
+
+    size_t TransactionFilter::accepted() const {
+      return accepted_;
+    }
+
+    size_t TransactionFilter::duplicates() const {
+      return duplicates_;
+    }
+
+    TransactionFilter::Stripe &TransactionFilter::stripe(
+        const hash256_t &hash) {
+      return stripes_[hash[0] % STRIPES];
+    }
+
+    uint64_t TransactionFilter::epoch() const {
+      return (Clock::now() - start_) / bucket_duration_;
+    }
+
+    void TransactionFilter::rotate(Stripe &stripe, uint64_t epoch) const {
+      if (epoch <= stripe.epoch) {
+        return;
+      }
+      // a gap longer than the window leaves only empty buckets
+      auto fresh = std::min<uint64_t>(epoch - stripe.epoch, buckets_);
+      for (uint64_t i = 0; i < fresh; ++i) {
+        stripe.buckets.emplace_back();
+      }
+      while (stripe.buckets.size() > buckets_) {
+        stripe.buckets.pop_front();
+      }
+      stripe.epoch = epoch;
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
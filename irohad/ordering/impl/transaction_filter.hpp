@@ -0,0 +1,119 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_TRANSACTION_FILTER_HPP
+#define IROHA_TRANSACTION_FILTER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "common/types.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Concurrent filter of transaction hashes which are pending in ordering
+     * service or were committed within a sliding time window. Pending hash
+     * is kept until it is committed or released. Window is split into
+     * buckets of exact hash sets, the oldest bucket is forgotten as a whole
+     * when a new one is started. Hashes are spread over independently locked
+     * stripes to reduce contention.
+     */
+    class TransactionFilter {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /**
+       * @param window - time a committed hash is remembered for, the oldest
+       * bucket
+       * is dropped at once, so a hash may be forgotten one bucket earlier
+       * @param buckets - number of buckets the window is split to
+       */
+      TransactionFilter(std::chrono::milliseconds window, size_t buckets);
+
+      /**
+       * Remember the hash as pending
+       * @param hash - hash of transaction
+       * @return true if the hash is neither pending nor committed within
+       * the window, false for a duplicate
+       */
+      bool insert(const hash256_t &hash);
+
+      /**
+       * Move pending hash to the window of committed ones
+       * @param hash - hash of committed transaction
+       */
+      void commit(const hash256_t &hash);
+
+      /**
+       * Forget pending hash, so the transaction may be received again
+       * @param hash - hash of transaction dropped without commit
+       */
+      void release(const hash256_t &hash);
+
+      /**
+       * @return number of accepted unique hashes
+       */
+      size_t accepted() const;
+
+      /**
+       * @return number of rejected duplicates
+       */
+      size_t duplicates() const;
+
+      static constexpr size_t STRIPES = 16;
+
+     private:
+      struct Stripe {
+        std::mutex mutex;
+        std::unordered_set<std::string> pending;
+        // committed hashes
+        std::deque<std::unordered_set<std::string>> buckets;
+        uint64_t epoch{0};
+      };
+
+      Stripe &stripe(const hash256_t &hash);
+
+      /**
+       * @return index of the current bucket since filter creation
+       */
+      uint64_t epoch() const;
+
+      /**
+       * Start new buckets up to the current epoch and forget the ones
+       * outside the window, stripe mutex must be held
+       */
+      void rotate(Stripe &stripe, uint64_t epoch) const;
+
+      const Clock::time_point start_;
+      const std::chrono::milliseconds bucket_duration_;
+      const size_t buckets_;
+      std::array<Stripe, STRIPES> stripes_;
+      std::atomic<size_t> accepted_{0};
+      std::atomic<size_t> duplicates_{0};
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_FILTER_HPP
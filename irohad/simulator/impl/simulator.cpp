@@ -17,6 +17,7 @@
 
 #include "simulator/impl/simulator.hpp"
 #include "crypto/hash.hpp"
+#include "crypto/merkle.hpp"
 
 namespace iroha {
   namespace simulator {
@@ -26,11 +27,13 @@ namespace iroha {
         std::shared_ptr<validation::StatefulValidator> statefulValidator,
         std::shared_ptr<ametsuchi::TemporaryFactory> factory,
         std::shared_ptr<ametsuchi::BlockQuery> blockQuery,
-        std::shared_ptr<model::ModelCryptoProvider> crypto_provider)
+        std::shared_ptr<model::ModelCryptoProvider> crypto_provider,
+        std::shared_ptr<ametsuchi::WriteSetCache> write_sets)
         : validator_(std::move(statefulValidator)),
           ametsuchi_factory_(std::move(factory)),
           block_queries_(std::move(blockQuery)),
-          crypto_provider_(std::move(crypto_provider)) {
+          crypto_provider_(std::move(crypto_provider)),
+          write_sets_(std::move(write_sets)) {
       log_ = logger::log("Simulator");
       ordering_gate->on_proposal().subscribe(
           [this](auto proposal) { this->process_proposal(proposal); });
@@ -46,6 +49,7 @@ namespace iroha {
 
     void Simulator::process_proposal(model::Proposal proposal) {
       log_->info("process proposal");
+      std::lock_guard<std::recursive_mutex> lock(mutex_);
       // Get last block from local ledger
       block_queries_->getTopBlocks(1)
           .as_blocking()
@@ -56,6 +60,13 @@ namespace iroha {
         log_->warn("Could not fetch last block");
         return;
       }
+      if (pending_block_
+          and pending_block_->block.height + 1 == proposal.height
+          and pending_block_->block.prev_hash == last_block.value().hash) {
+        // previous round is still in consensus
+        processSpeculativeProposal(proposal);
+        return;
+      }
       if (last_block.value().height + 1 != proposal.height) {
         log_->warn("Last block height: {}, proposal height: {}",
                    last_block.value().height,
@@ -63,22 +74,104 @@ namespace iroha {
         return;
       }
       auto temporaryStorage = ametsuchi_factory_->createTemporaryWsv();
-      notifier_.get_subscriber().on_next(
-          validator_->validate(proposal, *temporaryStorage));
+      if (not temporaryStorage) {
+        log_->error("Cannot create temporary wsv");
+        return;
+      }
+      auto verified_proposal =
+          validator_->validate(proposal, *temporaryStorage);
+      verified_write_set_ = temporaryStorage->writeSet();
+      notifier_.get_subscriber().on_next(verified_proposal);
+    }
+
+    void Simulator::processSpeculativeProposal(
+        const model::Proposal &proposal) {
+      auto start = std::chrono::steady_clock::now();
+      // overlay of committed state and changes of the pending block
+      auto temporaryStorage = ametsuchi_factory_->createTemporaryWsv();
+      if (not temporaryStorage
+          or not temporaryStorage->replay(pending_block_->write_set)) {
+        log_->warn("Cannot apply pending block, drop proposal {}",
+                   proposal.height);
+        return;
+      }
+      auto verified_proposal =
+          validator_->validate(proposal, *temporaryStorage);
+      const auto &changes = temporaryStorage->writeSet();
+      auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start);
+
+      speculative_ = nonstd::nullopt;
+      speculative_.emplace(SpeculativeProposal{
+          verified_proposal,
+          ametsuchi::WriteSet(
+              changes.begin() + pending_block_->write_set.size(),
+              changes.end()),
+          pending_block_->block.hash,
+          duration});
+      ++metrics_.speculative;
+      log_->info("proposal {} validated on top of uncommitted block",
+                 proposal.height);
+    }
+
+    void Simulator::process_commit() {
+      std::lock_guard<std::recursive_mutex> lock(mutex_);
+      pending_block_ = nonstd::nullopt;
+      if (not speculative_) {
+        return;
+      }
+      auto speculative = std::move(*speculative_);
+      speculative_ = nonstd::nullopt;
+      nonstd::optional<model::Block> top_block;
+      block_queries_->getTopBlocks(1).as_blocking().subscribe(
+          [&top_block](auto block) { top_block = block; });
+      if (not top_block or speculative.base_hash != top_block->hash) {
+        ++metrics_.discarded;
+        log_->info("other block committed, discard proposal {}",
+                   speculative.proposal.height);
+        logPipeline();
+        return;
+      }
+      ++metrics_.reused;
+      metrics_.overlap += speculative.duration;
+      logPipeline();
+
+      last_block = top_block;
+      verified_write_set_ = std::move(speculative.write_set);
+      notifier_.get_subscriber().on_next(speculative.proposal);
+    }
+
+    void Simulator::logPipeline() const {
+      log_->info("pipeline: reused {}, discarded {} of {} proposals, "
+                 "overlap {} us",
+                 metrics_.reused,
+                 metrics_.discarded,
+                 metrics_.speculative,
+                 metrics_.overlap.count());
     }
 
     void Simulator::process_verified_proposal(model::Proposal proposal) {
       log_->info("process verified proposal");
+      std::lock_guard<std::recursive_mutex> lock(mutex_);
       model::Block new_block;
       new_block.height = proposal.height;
       new_block.prev_hash = last_block.value().hash;
       new_block.transactions = proposal.transactions;
       new_block.txs_number = proposal.transactions.size();
       new_block.created_ts = 0; // TODO 14/08/17 Muratov set timestamp from proposal & for new model IR-501
-      new_block.merkle_root.fill(0); // TODO 14/08/17 Muratov make effective impl IR-464
+      new_block.merkle_root = merkleRoot(hash(new_block.transactions));
       new_block.hash = hash(new_block);
       crypto_provider_->sign(new_block);
 
+      // synchronizer applies these changes if the block is committed,
+      // next proposal may be validated on top of them before
+      if (verified_write_set_) {
+        pending_block_ = nonstd::nullopt;
+        pending_block_.emplace(PendingBlock{new_block, *verified_write_set_});
+        write_sets_->insert(new_block.hash, std::move(*verified_write_set_));
+        verified_write_set_ = nonstd::nullopt;
+      }
+
       block_notifier_.get_subscriber().on_next(new_block);
     }
 
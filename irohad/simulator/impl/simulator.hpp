@@ -18,9 +18,12 @@
 #ifndef IROHA_SIMULATOR_HPP
 #define IROHA_SIMULATOR_HPP
 
+#include <chrono>
+#include <mutex>
 #include <nonstd/optional.hpp>
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/temporary_factory.hpp"
+#include "ametsuchi/write_set_cache.hpp"
 #include "model/model_crypto_provider.hpp"
 #include "network/ordering_gate.hpp"
 #include "simulator/block_creator.hpp"
@@ -39,7 +42,8 @@ namespace iroha {
           std::shared_ptr<validation::StatefulValidator> statefulValidator,
           std::shared_ptr<ametsuchi::TemporaryFactory> factory,
           std::shared_ptr<ametsuchi::BlockQuery> blockQuery,
-          std::shared_ptr<model::ModelCryptoProvider> crypto_provider);
+          std::shared_ptr<model::ModelCryptoProvider> crypto_provider,
+          std::shared_ptr<ametsuchi::WriteSetCache> write_sets);
 
       Simulator(const Simulator&) = delete;
       Simulator& operator=(const Simulator&) = delete;
@@ -52,7 +56,57 @@ namespace iroha {
 
       rxcpp::observable<model::Block> on_block() override;
 
+      /**
+       * Finish the round after ledger is updated: proposal validated on top
+       * of the new top block is passed further, otherwise it is discarded
+       */
+      void process_commit();
+
      private:
+      /**
+       * Validate proposal on top of block which is still in consensus
+       * @param proposal - proposal following the pending block
+       */
+      void processSpeculativeProposal(const model::Proposal &proposal);
+
+      /**
+       * Log counters of speculative validation, mutex_ must be held
+       */
+      void logPipeline() const;
+
+      /**
+       * Counters of proposals validated while previous block is in consensus
+       */
+      struct PipelineMetrics {
+        // proposals validated on top of uncommitted block
+        size_t speculative = 0;
+        // speculative results used after their base block was committed
+        size_t reused = 0;
+        // speculative results dropped since other block was committed
+        size_t discarded = 0;
+        // validation time of reused results, hidden behind consensus
+        std::chrono::microseconds overlap{0};
+      };
+
+      /**
+       * Block created by simulator and not committed yet
+       */
+      struct PendingBlock {
+        model::Block block;
+        ametsuchi::WriteSet write_set;
+      };
+
+      /**
+       * Proposal validated on top of pending block
+       */
+      struct SpeculativeProposal {
+        model::Proposal proposal;
+        // changes of the proposal only, without pending block changes
+        ametsuchi::WriteSet write_set;
+        hash256_t base_hash;
+        std::chrono::microseconds duration;
+      };
+
       // internal
       rxcpp::subjects::subject<model::Proposal> notifier_;
       rxcpp::subjects::subject<model::Block> block_notifier_;
@@ -61,11 +115,22 @@ namespace iroha {
       std::shared_ptr<ametsuchi::TemporaryFactory> ametsuchi_factory_;
       std::shared_ptr<ametsuchi::BlockQuery> block_queries_;
       std::shared_ptr<model::ModelCryptoProvider> crypto_provider_;
+      std::shared_ptr<ametsuchi::WriteSetCache> write_sets_;
 
       logger::Logger log_;
 
       // last block
       nonstd::optional<model::Block> last_block;
+
+      // changes made by last verified proposal, kept for its block
+      nonstd::optional<ametsuchi::WriteSet> verified_write_set_;
+
+      nonstd::optional<PendingBlock> pending_block_;
+      nonstd::optional<SpeculativeProposal> speculative_;
+      PipelineMetrics metrics_;
+
+      // commit may come synchronously from created block processing
+      mutable std::recursive_mutex mutex_;
     };
   }  // namespace simulator
 }  // namespace iroha
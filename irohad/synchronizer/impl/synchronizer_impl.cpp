@@ -18,6 +18,7 @@
 #include <utility>
 
 #include "synchronizer/impl/synchronizer_impl.hpp"
+#include "crypto/hash.hpp"
 
 namespace iroha {
   namespace synchronizer {
@@ -26,10 +27,12 @@ namespace iroha {
         std::shared_ptr<network::ConsensusGate> consensus_gate,
         std::shared_ptr<validation::ChainValidator> validator,
         std::shared_ptr<ametsuchi::MutableFactory> mutableFactory,
-        std::shared_ptr<network::BlockLoader> blockLoader)
+        std::shared_ptr<network::BlockLoader> blockLoader,
+        std::shared_ptr<ametsuchi::WriteSetCache> write_sets)
         : validator_(std::move(validator)),
           mutableFactory_(std::move(mutableFactory)),
-          blockLoader_(std::move(blockLoader)) {
+          blockLoader_(std::move(blockLoader)),
+          write_sets_(std::move(write_sets)) {
       log_ = logger::log("synchronizer");
       consensus_gate->on_commit().subscribe([this](auto block) {
         this->process_commit(block);
@@ -43,7 +46,16 @@ namespace iroha {
         log_->error("Cannot create mutable storage");
         return;
       }
-      if (validator_->validateBlock(commit_message, *storage)) {
+      // Block created by this peer is already executed by simulator,
+      // apply its changes if committed block is the same
+      auto write_set = write_sets_->extract(commit_message.hash);
+      auto replayed = write_set
+          and hash(commit_message) == commit_message.hash
+          and validator_->validateBlock(commit_message, *write_set, *storage);
+      if (write_set and not replayed) {
+        log_->warn("cannot apply known changes of block, execute it");
+      }
+      if (replayed or validator_->validateBlock(commit_message, *storage)) {
         // Block can be applied to current storage
         // Commit to main Ametsuchi
         mutableFactory_->commit(std::move(storage));
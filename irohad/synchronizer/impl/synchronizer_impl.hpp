@@ -18,6 +18,7 @@
 #define IROHA_SYNCHRONIZER_IMPL_HPP
 
 #include "ametsuchi/mutable_factory.hpp"
+#include "ametsuchi/write_set_cache.hpp"
 #include "network/block_loader.hpp"
 #include "network/consensus_gate.hpp"
 #include "synchronizer/synchronizer.hpp"
@@ -33,7 +34,8 @@ namespace iroha {
           std::shared_ptr<network::ConsensusGate> consensus_gate,
           std::shared_ptr<validation::ChainValidator> validator,
           std::shared_ptr<ametsuchi::MutableFactory> mutableFactory,
-          std::shared_ptr<network::BlockLoader> blockLoader);
+          std::shared_ptr<network::BlockLoader> blockLoader,
+          std::shared_ptr<ametsuchi::WriteSetCache> write_sets);
 
       void process_commit(iroha::model::Block commit_message) override;
 
@@ -43,6 +45,7 @@ namespace iroha {
       std::shared_ptr<validation::ChainValidator> validator_;
       std::shared_ptr<ametsuchi::MutableFactory> mutableFactory_;
       std::shared_ptr<network::BlockLoader> blockLoader_;
+      std::shared_ptr<ametsuchi::WriteSetCache> write_sets_;
 
       // internal
       rxcpp::subjects::subject<Commit> notifier_;
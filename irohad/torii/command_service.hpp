@@ -25,6 +25,7 @@ limitations under the License.
 #include "ametsuchi/storage.hpp"
 #include "model/converters/pb_transaction_factory.hpp"
 #include "model/transaction_response.hpp"
+#include "network/ordering_gate.hpp"
 #include "torii/cache/cache.hpp"
 #include "torii/processor/transaction_processor.hpp"
 
@@ -37,11 +38,15 @@ namespace torii {
    */
   class CommandService {
    public:
+    /**
+     * @param ordering_gate - source of ordering queue depth and state
+     */
     CommandService(
         std::shared_ptr<iroha::model::converters::PbTransactionFactory>
             pb_factory,
         std::shared_ptr<iroha::torii::TransactionProcessor> txProcessor,
-        std::shared_ptr<iroha::ametsuchi::Storage> storage);
+        std::shared_ptr<iroha::ametsuchi::Storage> storage,
+        std::shared_ptr<iroha::network::OrderingGate> ordering_gate);
 
     CommandService(const CommandService &) = delete;
     CommandService &operator=(const CommandService &) = delete;
@@ -49,10 +54,15 @@ namespace torii {
      * actual implementation of async Torii in CommandService
      * @param request - Transaction
      * @param response - ToriiResponse
+     * @return RESOURCE_EXHAUSTED with current queue depth while ordering
+     * service rejects transactions, client should retry later
      */
-    void ToriiAsync(iroha::protocol::Transaction const &request,
-                    google::protobuf::Empty &response);
+    grpc::Status ToriiAsync(iroha::protocol::Transaction const &request,
+                            google::protobuf::Empty &response);
 
+    /**
+     * Status of transaction along with current ordering queue depth
+     */
     void StatusAsync(iroha::protocol::TxStatusRequest const &request,
                      iroha::protocol::ToriiResponse &response);
 
@@ -60,6 +70,7 @@ namespace torii {
     std::shared_ptr<iroha::model::converters::PbTransactionFactory> pb_factory_;
     std::shared_ptr<iroha::torii::TransactionProcessor> tx_processor_;
     std::shared_ptr<iroha::ametsuchi::Storage> storage_;
+    std::shared_ptr<iroha::network::OrderingGate> ordering_gate_;
     std::shared_ptr<iroha::cache::Cache<std::string,
                                         iroha::protocol::ToriiResponse>>
         cache_;
@@ -24,10 +24,12 @@ namespace torii {
       std::shared_ptr<iroha::model::converters::PbTransactionFactory>
           pb_factory,
       std::shared_ptr<iroha::torii::TransactionProcessor> txProcessor,
-      std::shared_ptr<iroha::ametsuchi::Storage> storage)
+      std::shared_ptr<iroha::ametsuchi::Storage> storage,
+      std::shared_ptr<iroha::network::OrderingGate> ordering_gate)
       : pb_factory_(pb_factory),
         tx_processor_(txProcessor),
         storage_(storage),
+        ordering_gate_(ordering_gate),
         cache_(std::make_shared<iroha::cache::
                                     Cache<std::string,
                                           iroha::protocol::ToriiResponse>>()) {
@@ -74,13 +76,21 @@ namespace torii {
     });
   }
 
-  void CommandService::ToriiAsync(iroha::protocol::Transaction const &request,
-                                  google::protobuf::Empty &empty) {
+  grpc::Status CommandService::ToriiAsync(
+      iroha::protocol::Transaction const &request,
+      google::protobuf::Empty &empty) {
+    // reject before any processing, so overload is not made worse
+    if (ordering_gate_->overloaded()) {
+      return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                          "ordering queue is full, queue depth: "
+                              + std::to_string(ordering_gate_->queueDepth()));
+    }
+
     auto iroha_tx = pb_factory_->deserialize(request);
     auto tx_hash = iroha::hash(*iroha_tx).to_string();
 
     if (cache_->findItem(tx_hash)) {
-      return;
+      return grpc::Status::OK;
     }
 
     iroha::protocol::ToriiResponse response;
@@ -89,6 +99,7 @@ namespace torii {
     cache_->addItem(tx_hash, response);
     // Send transaction to iroha
     tx_processor_->transactionHandle(iroha_tx);
+    return grpc::Status::OK;
   }
 
   void CommandService::StatusAsync(
@@ -105,6 +116,7 @@ namespace torii {
       }
       cache_->addItem(request.tx_hash(), response);
     }
+    response.set_queue_depth(ordering_gate_->queueDepth());
   }
 
 }  // namespace torii
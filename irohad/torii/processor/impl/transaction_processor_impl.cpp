@@ -37,10 +37,10 @@ namespace iroha {
 
       // insert all txs from proposal to proposal set
       pcs_->on_proposal().subscribe([this](model::Proposal proposal) {
-        for (const auto &tx : proposal.transactions) {
-          proposal_set_.insert(hash(tx).to_string());
+        for (const auto &tx_hash : hash(proposal.transactions)) {
+          proposal_set_.insert(tx_hash.to_string());
           TransactionResponse response;
-          response.tx_hash = hash(tx).to_string();
+          response.tx_hash = tx_hash.to_string();
           response.current_status =
               TransactionResponse::STATELESS_VALIDATION_SUCCESS;
           notifier_.get_subscriber().on_next(
@@ -54,12 +54,13 @@ namespace iroha {
         blocks.subscribe(
             // on next..
             [this](model::Block block) {
-              for (const auto &tx : block.transactions) {
-                if (this->proposal_set_.count(hash(tx).to_string())) {
-                  proposal_set_.erase(hash(tx).to_string());
-                  candidate_set_.insert(hash(tx).to_string());
+              for (const auto &hash_blob : hash(block.transactions)) {
+                auto tx_hash = hash_blob.to_string();
+                if (this->proposal_set_.count(tx_hash)) {
+                  proposal_set_.erase(tx_hash);
+                  candidate_set_.insert(tx_hash);
                   TransactionResponse response;
-                  response.tx_hash = hash(tx).to_string();
+                  response.tx_hash = tx_hash;
                   response.current_status =
                       model::TransactionResponse::STATEFUL_VALIDATION_SUCCESS;
                   notifier_.get_subscriber().on_next(
@@ -101,8 +101,8 @@ namespace torii {
    */
   void ToriiServiceHandler::ToriiHandler(
       CommandServiceCall<prot::Transaction, google::protobuf::Empty>* call) {
-    command_service_->ToriiAsync(call->request(), call->response());
-    call->sendResponse(grpc::Status::OK);
+    call->sendResponse(
+        command_service_->ToriiAsync(call->request(), call->response()));
 
     // Spawn a new Call instance to serve an another client.
     enqueueRequest<prot::CommandService::AsyncService, prot::Transaction,
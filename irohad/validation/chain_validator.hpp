@@ -54,6 +54,18 @@ namespace iroha {
        */
       virtual bool validateBlock(const model::Block &block,
                                  ametsuchi::MutableStorage &storage) = 0;
+
+      /**
+       * Block validation, which applies known changes of block transactions
+       * instead of executing them.
+       * @param block - block to validate
+       * @param write_set - changes made by transactions of the block
+       * @param storage -  storage that may be modified during block appliance
+       * @return true if block is valid and can be applied, false otherwise
+       */
+      virtual bool validateBlock(const model::Block &block,
+                                 const ametsuchi::WriteSet &write_set,
+                                 ametsuchi::MutableStorage &storage) = 0;
     };
   }  // namespace validation
 }  // namespace iroha
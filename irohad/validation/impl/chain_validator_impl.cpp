@@ -17,11 +17,21 @@
 
 #include "validation/impl/chain_validator_impl.hpp"
 
+#include <tbb/concurrent_queue.h>
+#include <tbb/task_arena.h>
+#include <atomic>
+#include <future>
+#include <thread>
+
 #include "consensus/consensus_common.hpp"
+#include "crypto/hash.hpp"
+#include "crypto/merkle.hpp"
 
 namespace iroha {
   namespace validation {
-    ChainValidatorImpl::ChainValidatorImpl() {
+    ChainValidatorImpl::ChainValidatorImpl(
+        std::shared_ptr<model::ModelCryptoProvider> crypto_provider)
+        : crypto_provider_(std::move(crypto_provider)) {
       log_ = logger::log("ChainValidator");
     }
 
@@ -29,34 +39,143 @@ namespace iroha {
                                            ametsuchi::MutableStorage &storage) {
       log_->info("validate block: height {}, hash {}", block.height,
                  block.hash.to_hexstring());
-      auto apply_block = [](const auto &block, auto &queries,
-                            const auto &top_hash) {
-        auto peers = queries.getPeers();
-        if (not peers.has_value()) {
-          return false;
-        }
-        return block.prev_hash == top_hash and
-               consensus::hasSupermajority(block.sigs.size(),
-                                           peers.value().size()) and
-               consensus::peersSubset(block.sigs, peers.value());
-      };
 
+      if (not checkMerkleRoot(block)) {
+        return false;
+      }
       // Apply to temporary storage
-      return storage.apply(block, apply_block);
+      return storage.apply(block, checkBlock);
+    }
+
+    bool ChainValidatorImpl::validateBlock(
+        const model::Block &block,
+        const ametsuchi::WriteSet &write_set,
+        ametsuchi::MutableStorage &storage) {
+      log_->info("validate block with known changes: height {}, hash {}",
+                 block.height,
+                 block.hash.to_hexstring());
+      // merkle root is not recomputed, block with known changes is created
+      // by this peer and its hash is checked by the caller
+      return storage.replay(block, write_set, checkBlock);
+    }
+
+    bool ChainValidatorImpl::checkBlock(const model::Block &block,
+                                        ametsuchi::WsvQuery &queries,
+                                        const hash256_t &top_hash) {
+      auto peers = queries.getPeers();
+      if (not peers.has_value()) {
+        return false;
+      }
+      return block.prev_hash == top_hash and
+             consensus::hasSupermajority(block.sigs.size(),
+                                         peers.value().size()) and
+             consensus::peersSubset(block.sigs, peers.value());
+    }
+
+    bool ChainValidatorImpl::verifyBlock(
+        const model::Block &block,
+        const nonstd::optional<hash256_t> &prev_hash) const {
+      return (not prev_hash or block.prev_hash == *prev_hash)
+          and crypto_provider_->verify(block) and checkMerkleRoot(block);
+    }
+
+    bool ChainValidatorImpl::checkMerkleRoot(const model::Block &block) const {
+      if (merkleRoot(hash(block.transactions)) != block.merkle_root) {
+        log_->warn("merkle root of block {} does not match its transactions",
+                   block.hash.to_hexstring());
+        return false;
+      }
+      return true;
     }
 
     bool ChainValidatorImpl::validateChain(Commit blocks,
                                            ametsuchi::MutableStorage &storage) {
       log_->info("validate chain...");
-      return blocks
-          .all([this, &storage](auto block) {
-            log_->info("Validating block: height {}, hash {}",
-                       block.height,
-                       block.hash.to_hexstring());
-            return this->validateBlock(block, storage);
-          })
-          .as_blocking()
-          .first();
+      // Block in the window, its checks are running in parallel
+      struct PendingBlock {
+        model::Block block;
+        std::future<bool> verified;
+      };
+      // null marks the end of the chain
+      tbb::concurrent_bounded_queue<std::shared_ptr<PendingBlock>> window;
+      window.set_capacity(VERIFICATION_WINDOW);
+      // enqueued tasks run even without worker threads
+      tbb::task_arena checks;
+      std::atomic<bool> stopped(false);
+      std::atomic<bool> stream_failed(false);
+      rxcpp::composite_subscription subscription;
+
+      // receive blocks and start their checks ahead of apply
+      std::thread receiver([&] {
+        nonstd::optional<hash256_t> prev_hash;
+        blocks.subscribe(
+            subscription,
+            [&](auto block) {
+              if (stopped) {
+                return;
+              }
+              auto check = std::make_shared<std::packaged_task<bool()>>(
+                  [this, block, prev_hash] {
+                    return this->verifyBlock(block, prev_hash);
+                  });
+              prev_hash = block.hash;
+              window.push(std::make_shared<PendingBlock>(
+                  PendingBlock{block, check->get_future()}));
+              checks.enqueue([check] { (*check)(); });
+            },
+            [&](std::exception_ptr) { stream_failed = true; });
+        // chain is received synchronously, subscribe returns when it is
+        // completed, failed or cancelled
+        window.push(nullptr);
+      });
+
+      // cancel the rest of the chain, wait for checks in flight since they
+      // hold the validator and let the receiver finish
+      auto stop_receiver = [&] {
+        stopped = true;
+        subscription.unsubscribe();
+        std::shared_ptr<PendingBlock> rest;
+        do {
+          window.pop(rest);
+          if (rest) {
+            rest->verified.wait();
+          }
+        } while (rest);
+        receiver.join();
+      };
+
+      // apply verified blocks in order of the chain
+      auto valid = true;
+      try {
+        std::shared_ptr<PendingBlock> pending;
+        while (true) {
+          window.pop(pending);
+          if (not pending) {
+            receiver.join();
+            break;
+          }
+          const auto &block = pending->block;
+          log_->info("Validating block: height {}, hash {}",
+                     block.height,
+                     block.hash.to_hexstring());
+          if (not pending->verified.get()) {
+            log_->warn(
+                "Invalid signatures, link to previous block or merkle root");
+            valid = false;
+          } else {
+            // merkle root is verified already
+            valid = storage.apply(block, checkBlock);
+          }
+          if (not valid) {
+            stop_receiver();
+            break;
+          }
+        }
+      } catch (...) {
+        stop_receiver();
+        throw;
+      }
+      return valid and not stream_failed;
     }
   }
 }
@@ -25,7 +25,8 @@ namespace iroha {
   namespace validation {
     class ChainValidatorImpl : public ChainValidator {
      public:
-      ChainValidatorImpl();
+      explicit ChainValidatorImpl(
+          std::shared_ptr<model::ModelCryptoProvider> crypto_provider);
 
       bool validateChain(Commit blocks,
                          ametsuchi::MutableStorage &storage) override;
@@ -33,7 +34,40 @@ namespace iroha {
       bool validateBlock(const model::Block &block,
                          ametsuchi::MutableStorage &storage) override;
 
+      bool validateBlock(const model::Block &block,
+                         const ametsuchi::WriteSet &write_set,
+                         ametsuchi::MutableStorage &storage) override;
+
      private:
+      // number of blocks verified ahead of the applied one
+      static constexpr size_t VERIFICATION_WINDOW = 32;
+
+      /**
+       * Checks which do not depend on ledger state: block signatures,
+       * merkle root and link to the previous block of the chain
+       * @param block - block to check
+       * @param prev_hash - hash of previous block in the chain, if any
+       * @return true if checks passed, false otherwise
+       */
+      bool verifyBlock(const model::Block &block,
+                       const nonstd::optional<hash256_t> &prev_hash) const;
+
+      /**
+       * Recompute merkle root of block transactions
+       * @param block - block to check
+       * @return true if it matches merkle root of the block
+       */
+      bool checkMerkleRoot(const model::Block &block) const;
+
+      /**
+       * Check that block follows top block and is signed by supermajority
+       * of peers
+       */
+      static bool checkBlock(const model::Block &block,
+                             ametsuchi::WsvQuery &queries,
+                             const hash256_t &top_hash);
+
+      std::shared_ptr<model::ModelCryptoProvider> crypto_provider_;
 
       logger::Logger log_;
 
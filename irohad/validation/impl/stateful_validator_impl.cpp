@@ -16,58 +16,173 @@
  */
 
 #include "validation/impl/stateful_validator_impl.hpp"
+#include <tbb/parallel_for.h>
+#include <algorithm>
 #include <numeric>
 #include <set>
 
 namespace iroha {
   namespace validation {
 
-    StatefulValidatorImpl::StatefulValidatorImpl() {
+    StatefulValidatorImpl::StatefulValidatorImpl()
+        : StatefulValidatorImpl(nullptr, 1) {}
+
+    StatefulValidatorImpl::StatefulValidatorImpl(
+        std::shared_ptr<ametsuchi::TemporaryFactory> factory,
+        size_t max_parallelism)
+        : factory_(std::move(factory)),
+          max_parallelism_(std::max<size_t>(max_parallelism, 1)) {
       log_ = logger::log("SFV");
     }
 
+    bool StatefulValidatorImpl::checkTransaction(
+        const model::Transaction &tx, ametsuchi::WsvQuery &queries) {
+      return (queries.getAccount(tx.creator_account_id)
+              | [&](const auto &account) {
+                  // Check if tx creator has account and has quorum to
+                  // execute transaction
+                  return tx.signatures.size() >= account.quorum
+                      ? queries.getSignatories(tx.creator_account_id)
+                      : nonstd::nullopt;
+                }
+              | [&](const auto &signatories) {
+                  // Check if signatures in transaction are account signatory
+                  return this->signaturesSubset(tx.signatures, signatories)
+                      ? nonstd::make_optional(signatories)
+                      : nonstd::nullopt;
+                })
+          .has_value();
+    }
+
+    std::vector<std::vector<size_t>> StatefulValidatorImpl::scheduleWorkers(
+        const std::vector<model::Transaction> &txs) const {
+      if (not factory_ or max_parallelism_ == 1 or txs.size() < 2) {
+        std::vector<size_t> all(txs.size());
+        std::iota(all.begin(), all.end(), 0);
+        return {all};
+      }
+
+      auto groups = partitioner_.partition(txs);
+      // biggest groups first, each goes to the least loaded worker
+      std::sort(groups.begin(), groups.end(), [](auto &lhs, auto &rhs) {
+        return lhs.size() > rhs.size();
+      });
+      std::vector<std::vector<size_t>> workers(
+          std::min(max_parallelism_, groups.size()));
+      for (auto &group : groups) {
+        auto worker = std::min_element(
+            workers.begin(), workers.end(), [](auto &lhs, auto &rhs) {
+              return lhs.size() < rhs.size();
+            });
+        worker->insert(worker->end(), group.begin(), group.end());
+      }
+      // groups are independent, but keep proposal order for readability
+      for (auto &worker : workers) {
+        std::sort(worker.begin(), worker.end());
+      }
+      return workers;
+    }
+
     model::Proposal StatefulValidatorImpl::validate(
         const model::Proposal &proposal,
         ametsuchi::TemporaryWsv &temporaryWsv) {
       log_->info("transactions in proposal: {}", proposal.transactions.size());
       auto checking_transaction = [this](auto &tx, auto &queries) {
-        return (queries.getAccount(tx.creator_account_id)
-        | [&](const auto &account) {
-              // Check if tx creator has account and has quorum to execute
-              // transaction
-              return tx.signatures.size() >= account.quorum
-                  ? queries.getSignatories(tx.creator_account_id)
-                  : nonstd::nullopt;
-            }
-        | [&](const auto &signatories) {
-            // Check if signatures in transaction are account signatory
-            return this->signaturesSubset(tx.signatures, signatories)
-                ? nonstd::make_optional(signatories)
-                : nonstd::nullopt;
-          }).has_value();
+        return this->checkTransaction(tx, queries);
       };
 
-      // Filter only valid transactions
-      auto filter = [&temporaryWsv, checking_transaction](auto &acc,
-                                                          const auto &tx) {
-        auto answer = temporaryWsv.apply(tx, checking_transaction);
-        if (answer) {
-          acc.push_back(tx);
+      const auto &txs = proposal.transactions;
+      // not std::vector<bool>, workers write to neighbour elements
+      std::vector<uint8_t> valid(txs.size(), false);
+      auto apply = [&](ametsuchi::TemporaryWsv &wsv,
+                       const std::vector<size_t> &indexes) {
+        for (auto i : indexes) {
+          valid[i] = wsv.apply(txs[i], checking_transaction);
         }
-        return acc;
       };
 
-      auto &txs = proposal.transactions;
-      decltype(txs) valid = {};
+      auto workers = scheduleWorkers(txs);
+      if (workers.size() == 1) {
+        apply(temporaryWsv, workers.front());
+      } else {
+        log_->info("validate independent transactions in {} workers",
+                   workers.size());
+        // given wsv may already contain changes, e.g. of uncommitted block,
+        // the other workers start from the same state
+        const auto base = temporaryWsv.writeSet();
+        // first worker reuses given wsv, the others get their own
+        std::vector<std::unique_ptr<ametsuchi::TemporaryWsv>> wsvs(
+            workers.size());
+        tbb::parallel_for(size_t(0), workers.size(), [&](size_t i) {
+          if (i == 0) {
+            apply(temporaryWsv, workers[i]);
+            return;
+          }
+          wsvs[i] = this->acquireWsv();
+          if (wsvs[i] and not wsvs[i]->replay(base)) {
+            wsvs[i] = nullptr;
+          }
+          if (wsvs[i]) {
+            apply(*wsvs[i], workers[i]);
+          }
+        });
+        // merge changes of the other workers to given wsv, their
+        // transactions do not depend on each other
+        for (size_t i = 1; i < workers.size(); ++i) {
+          if (wsvs[i]
+              and temporaryWsv.replay(ametsuchi::WriteSet(
+                      wsvs[i]->writeSet().begin() + base.size(),
+                      wsvs[i]->writeSet().end()))) {
+            continue;
+          }
+          log_->warn("cannot merge changes of worker, apply sequentially");
+          apply(temporaryWsv, workers[i]);
+        }
+        for (auto &wsv : wsvs) {
+          if (wsv) {
+            releaseWsv(std::move(wsv));
+          }
+        }
+      }
+
+      // Filter only valid transactions
+      std::vector<model::Transaction> valid_txs;
+      for (size_t i = 0; i < txs.size(); ++i) {
+        if (valid[i]) {
+          valid_txs.push_back(txs[i]);
+        }
+      }
 
-      model::Proposal validated_proposal(
-          std::accumulate(txs.begin(), txs.end(), valid, filter));
+      model::Proposal validated_proposal(valid_txs);
       validated_proposal.height = proposal.height;
       log_->info("transactions in verified proposal: {}",
                  validated_proposal.transactions.size());
       return validated_proposal;
     }
 
+    std::unique_ptr<ametsuchi::TemporaryWsv>
+    StatefulValidatorImpl::acquireWsv() {
+      {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        if (not pool_.empty()) {
+          auto wsv = std::move(pool_.back());
+          pool_.pop_back();
+          return wsv;
+        }
+      }
+      return factory_->createTemporaryWsv();
+    }
+
+    void StatefulValidatorImpl::releaseWsv(
+        std::unique_ptr<ametsuchi::TemporaryWsv> wsv) {
+      wsv->reset();
+      std::lock_guard<std::mutex> lock(pool_mutex_);
+      // the first worker uses given wsv
+      if (pool_.size() < max_parallelism_ - 1) {
+        pool_.push_back(std::move(wsv));
+      }
+    }
+
     bool StatefulValidatorImpl::signaturesSubset(
         const model::Transaction::SignaturesType &signatures,
         const std::vector<pubkey_t> &public_keys) {
@@ -19,7 +19,11 @@
 
 #include "validation/stateful_validator.hpp"
 
+#include <mutex>
+
+#include "ametsuchi/temporary_factory.hpp"
 #include "logger/logger.hpp"
+#include "validation/impl/transaction_partitioner.hpp"
 
 namespace iroha {
   namespace validation {
@@ -31,19 +35,47 @@ namespace iroha {
      public:
       StatefulValidatorImpl();
 
+      /**
+       * Create validator which applies independent transactions in parallel
+       * @param factory - factory of temporary wsv for parallel workers,
+       * it must produce wsv with the same state as passed to validate
+       * @param max_parallelism - maximum number of wsv used for one proposal,
+       * wsv of workers are kept for the next proposals
+       */
+      StatefulValidatorImpl(
+          std::shared_ptr<ametsuchi::TemporaryFactory> factory,
+          size_t max_parallelism);
+
       /**
        * Function perform stateful validation on proposal
        * and return proposal with valid transactions
        * @param proposal - proposal for validation
        * @param wsv  - temporary wsv for validation,
        * this wsv not affected on ledger,
-       * all changes after removing wsv will be ignored
+       * all changes after removing wsv will be ignored.
+       * When transactions are validated in parallel, changes of the other
+       * workers are replayed on wsv afterwards
        * @return proposal with valid transactions
        */
       model::Proposal validate(const model::Proposal &proposal,
                                ametsuchi::TemporaryWsv &temporaryWsv) override;
 
      private:
+      /**
+       * Stateful checks of the transaction: creator account exists,
+       * quorum is reached and signatures belong to the account
+       */
+      bool checkTransaction(const model::Transaction &tx,
+                            ametsuchi::WsvQuery &queries);
+
+      /**
+       * Distribute groups of independent transactions among workers
+       * @param txs - proposal transactions
+       * @return indexes of transactions for each worker in ascending order
+       */
+      std::vector<std::vector<size_t>> scheduleWorkers(
+          const std::vector<model::Transaction> &txs) const;
+
       /**
        * Checks if public keys of signatures are present in vector of pubkeys
        * @param signatures - collection of signatures
@@ -55,6 +87,28 @@ namespace iroha {
           const model::Transaction::SignaturesType &signatures,
           const std::vector<pubkey_t> &public_keys);
 
+      /**
+       * Take wsv for a worker from the pool or create new one
+       * @return wsv with state of ledger, nullptr if it can not be created
+       */
+      std::unique_ptr<ametsuchi::TemporaryWsv> acquireWsv();
+
+      /**
+       * Discard changes of worker wsv and keep it for the next proposal
+       */
+      void releaseWsv(std::unique_ptr<ametsuchi::TemporaryWsv> wsv);
+
+      std::shared_ptr<ametsuchi::TemporaryFactory> factory_;
+      size_t max_parallelism_;
+
+      /**
+       * Wsv of workers between proposals, so their database connections are
+       * not opened for every proposal
+       */
+      std::vector<std::unique_ptr<ametsuchi::TemporaryWsv>> pool_;
+      std::mutex pool_mutex_;
+      TransactionPartitioner partitioner_;
+
       logger::Logger log_;
     };
   }  // namespace validation
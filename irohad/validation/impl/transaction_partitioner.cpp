@@ -0,0 +1,216 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "validation/impl/transaction_partitioner.hpp"
+
+#include <numeric>
+#include <unordered_map>
+
+#include "model/commands/add_asset_quantity.hpp"
+#include "model/commands/add_signatory.hpp"
+#include "model/commands/append_role.hpp"
+#include "model/commands/create_account.hpp"
+#include "model/commands/create_asset.hpp"
+#include "model/commands/create_domain.hpp"
+#include "model/commands/grant_permission.hpp"
+#include "model/commands/remove_signatory.hpp"
+#include "model/commands/revoke_permission.hpp"
+#include "model/commands/set_account_detail.hpp"
+#include "model/commands/set_quorum.hpp"
+#include "model/commands/transfer_asset.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    namespace {
+      std::string accountKey(const std::string &account_id) {
+        return "account:" + account_id;
+      }
+
+      std::string assetKey(const std::string &asset_id) {
+        return "asset:" + asset_id;
+      }
+
+      std::string domainKey(const std::string &domain_id) {
+        return "domain:" + domain_id;
+      }
+
+      std::string signatoryKey(const pubkey_t &pubkey) {
+        return "signatory:" + pubkey.to_hexstring();
+      }
+
+      std::string roleKey(const std::string &role_name) {
+        return "role:" + role_name;
+      }
+
+      /**
+       * Disjoint set union over transaction indexes
+       */
+      class Groups {
+       public:
+        explicit Groups(size_t size) : parent_(size) {
+          std::iota(parent_.begin(), parent_.end(), 0);
+        }
+
+        size_t find(size_t i) {
+          while (parent_[i] != i) {
+            parent_[i] = parent_[parent_[i]];
+            i = parent_[i];
+          }
+          return i;
+        }
+
+        void unite(size_t a, size_t b) {
+          a = find(a);
+          b = find(b);
+          // keep the smallest index as root to order groups cheaply
+          if (a < b) {
+            parent_[b] = a;
+          } else if (b < a) {
+            parent_[a] = b;
+          }
+        }
+
+       private:
+        std::vector<size_t> parent_;
+      };
+    }  // namespace
+
+    AccessSet TransactionPartitioner::accessSet(
+        const model::Transaction &tx) const {
+      AccessSet set;
+      // account, quorum, signatories, roles and grantable permissions of
+      // creator are checked for every transaction
+      set.reads.insert(accountKey(tx.creator_account_id));
+
+      for (const auto &command : tx.commands) {
+        const auto &cmd = *command;
+        if (instanceof <model::TransferAsset>(cmd)) {
+          const auto &transfer = static_cast<const model::TransferAsset &>(cmd);
+          set.writes.insert(accountKey(transfer.src_account_id));
+          set.writes.insert(accountKey(transfer.dest_account_id));
+          set.reads.insert(assetKey(transfer.asset_id));
+        } else if (instanceof <model::AddAssetQuantity>(cmd)) {
+          const auto &add = static_cast<const model::AddAssetQuantity &>(cmd);
+          set.writes.insert(accountKey(add.account_id));
+          set.reads.insert(assetKey(add.asset_id));
+        } else if (instanceof <model::AddSignatory>(cmd)) {
+          const auto &add = static_cast<const model::AddSignatory &>(cmd);
+          set.writes.insert(accountKey(add.account_id));
+          set.writes.insert(signatoryKey(add.pubkey));
+        } else if (instanceof <model::RemoveSignatory>(cmd)) {
+          const auto &remove = static_cast<const model::RemoveSignatory &>(cmd);
+          set.writes.insert(accountKey(remove.account_id));
+          set.writes.insert(signatoryKey(remove.pubkey));
+        } else if (instanceof <model::SetQuorum>(cmd)) {
+          const auto &quorum = static_cast<const model::SetQuorum &>(cmd);
+          set.writes.insert(accountKey(quorum.account_id));
+        } else if (instanceof <model::SetAccountDetail>(cmd)) {
+          const auto &detail =
+              static_cast<const model::SetAccountDetail &>(cmd);
+          set.writes.insert(accountKey(detail.account_id));
+        } else if (instanceof <model::CreateAccount>(cmd)) {
+          const auto &create = static_cast<const model::CreateAccount &>(cmd);
+          set.writes.insert(
+              accountKey(create.account_name + "@" + create.domain_id));
+          set.writes.insert(signatoryKey(create.pubkey));
+          set.reads.insert(domainKey(create.domain_id));
+        } else if (instanceof <model::CreateAsset>(cmd)) {
+          const auto &create = static_cast<const model::CreateAsset &>(cmd);
+          set.writes.insert(
+              assetKey(create.asset_name + "#" + create.domain_id));
+          set.reads.insert(domainKey(create.domain_id));
+        } else if (instanceof <model::CreateDomain>(cmd)) {
+          const auto &create = static_cast<const model::CreateDomain &>(cmd);
+          set.writes.insert(domainKey(create.domain_id));
+          set.reads.insert(roleKey(create.user_default_role));
+        } else if (instanceof <model::AppendRole>(cmd)) {
+          const auto &append = static_cast<const model::AppendRole &>(cmd);
+          set.writes.insert(accountKey(append.account_id));
+          set.reads.insert(roleKey(append.role_name));
+        } else if (instanceof <model::GrantPermission>(cmd)) {
+          const auto &grant = static_cast<const model::GrantPermission &>(cmd);
+          set.writes.insert(accountKey(grant.account_id));
+          set.writes.insert(accountKey(tx.creator_account_id));
+        } else if (instanceof <model::RevokePermission>(cmd)) {
+          const auto &revoke =
+              static_cast<const model::RevokePermission &>(cmd);
+          set.writes.insert(accountKey(revoke.account_id));
+          set.writes.insert(accountKey(tx.creator_account_id));
+        } else {
+          // CreateRole, AddPeer and unknown commands change state
+          // shared by all accounts
+          set.global = true;
+        }
+      }
+      return set;
+    }
+
+    std::vector<std::vector<size_t>> TransactionPartitioner::partition(
+        const std::vector<model::Transaction> &txs) const {
+      Groups groups(txs.size());
+
+      struct KeyUsage {
+        std::vector<size_t> txs;
+        bool written = false;
+      };
+      std::unordered_map<std::string, KeyUsage> usages;
+
+      for (size_t i = 0; i < txs.size(); ++i) {
+        auto set = accessSet(txs[i]);
+        if (set.global) {
+          // conservative: whole proposal is applied sequentially
+          std::vector<size_t> all(txs.size());
+          std::iota(all.begin(), all.end(), 0);
+          return {all};
+        }
+        for (const auto &key : set.reads) {
+          usages[key].txs.push_back(i);
+        }
+        for (const auto &key : set.writes) {
+          auto &usage = usages[key];
+          usage.txs.push_back(i);
+          usage.written = true;
+        }
+      }
+
+      // keys which are only read do not create dependencies
+      for (const auto &usage : usages) {
+        if (not usage.second.written) {
+          continue;
+        }
+        for (auto tx : usage.second.txs) {
+          groups.unite(usage.second.txs.front(), tx);
+        }
+      }
+
+      std::vector<std::vector<size_t>> result;
+      std::unordered_map<size_t, size_t> group_position;
+      for (size_t i = 0; i < txs.size(); ++i) {
+        auto root = groups.find(i);
+        auto it = group_position.find(root);
+        if (it == group_position.end()) {
+          it = group_position.emplace(root, result.size()).first;
+          result.emplace_back();
+        }
+        result[it->second].push_back(i);
+      }
+      return result;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_TRANSACTION_PARTITIONER_HPP
+#define IROHA_TRANSACTION_PARTITIONER_HPP
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "model/transaction.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Keys of world state which transaction reads and writes during
+     * stateful validation and execution
+     */
+    struct AccessSet {
+      std::set<std::string> reads;
+      std::set<std::string> writes;
+
+      /**
+       * Transaction may touch any part of the state,
+       * e.g. it changes roles or peers
+       */
+      bool global = false;
+    };
+
+    /**
+     * Splits proposal transactions into groups that do not share state.
+     * Transactions from different groups may be applied independently,
+     * transactions inside a group must be applied in proposal order
+     */
+    class TransactionPartitioner {
+     public:
+      /**
+       * Collect keys touched by transaction: creator account,
+       * accounts, assets, domains and signatories from commands
+       * @param tx - transaction to inspect
+       * @return access set of the transaction
+       */
+      AccessSet accessSet(const model::Transaction &tx) const;
+
+      /**
+       * Group transactions, two transactions are in the same group
+       * if one of them writes a key the other one reads or writes
+       * @param txs - transactions in proposal order
+       * @return groups of indexes in txs, indexes in a group are ascending,
+       * groups are ordered by their first index
+       */
+      std::vector<std::vector<size_t>> partition(
+          const std::vector<model::Transaction> &txs) const;
+    };
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_PARTITIONER_HPP
@@ -18,8 +18,10 @@
 #ifndef IROHA_COMMON_TYPES_HPP
 #define IROHA_COMMON_TYPES_HPP
 
+#include <algorithm>
 #include <array>
 #include <cstdio>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <string>
@@ -335,4 +337,24 @@ namespace iroha {
   }
 
 }  // namespace iroha
+
+namespace std {
+  /**
+   * Hash of blob for unordered containers. Blobs are mostly digests and keys,
+   * so their words are combined without copying the blob to a string
+   */
+  template <size_t size_>
+  struct hash<iroha::blob_t<size_>> {
+    size_t operator()(const iroha::blob_t<size_> &blob) const noexcept {
+      size_t result = size_;
+      for (size_t i = 0; i < size_; i += sizeof(size_t)) {
+        size_t word = 0;
+        std::memcpy(
+            &word, blob.data() + i, std::min(sizeof(size_t), size_ - i));
+        result ^= word + 0x9e3779b97f4a7c15ull + (result << 6) + (result >> 2);
+      }
+      return result;
+    }
+  };
+}  // namespace std
 #endif  // IROHA_COMMON_TYPES_HPP
@@ -325,3 +325,212 @@ void sha3_512(const unsigned char *message, size_t message_len, unsigned char *o
     sha3_Update(&ctx, message, message_len);
     sha3_Finalize(&ctx, out);
 }
+
+/* *********************** Multi-buffer SHA3-256 *********************** */
+
+/* SHA3-256 absorbs 136 bytes (17 words) per permutation */
+#define SHA3_256_RATE_WORDS \
+(SHA3_KECCAK_SPONGE_WORDS - 2 * 256 / (8 * sizeof(uint64_t)))
+#define SHA3_256_RATE_BYTES (SHA3_256_RATE_WORDS * sizeof(uint64_t))
+#define SHA3_MAX_LANES 8
+
+/* Permutes `lanes` interleaved states: word w of lane l is state[w * lanes + l] */
+typedef void (*sha3_keccakf_lanes_fn)(uint64_t *state);
+
+/* Same rounds as keccakf() above, written over a vector of independent
+ * states. Every operation is applied to all lanes at once. */
+#define SHA3_KECCAKF_LANES_BODY(vec_t, LANES, LOAD, STORE, XOR, ANDNOT, ROTL, SET1) \
+    vec_t a[25], bc[5], t;                                                  \
+    int i, j, round;                                                        \
+                                                                            \
+    for(i = 0; i < 25; i++)                                                 \
+        a[i] = LOAD(state + i * (LANES));                                   \
+                                                                            \
+    for(round = 0; round < KECCAK_ROUNDS; round++) {                        \
+        /* Theta */                                                         \
+        for(i = 0; i < 5; i++)                                              \
+            bc[i] = XOR(XOR(XOR(a[i], a[i + 5]), XOR(a[i + 10], a[i + 15])), \
+                        a[i + 20]);                                         \
+        for(i = 0; i < 5; i++) {                                            \
+            t = XOR(bc[(i + 4) % 5], ROTL(bc[(i + 1) % 5], 1));             \
+            for(j = 0; j < 25; j += 5)                                      \
+                a[j + i] = XOR(a[j + i], t);                                \
+        }                                                                   \
+        /* Rho Pi */                                                        \
+        t = a[1];                                                           \
+        for(i = 0; i < 24; i++) {                                           \
+            j = keccakf_piln[i];                                            \
+            bc[0] = a[j];                                                   \
+            a[j] = ROTL(t, keccakf_rotc[i]);                                \
+            t = bc[0];                                                      \
+        }                                                                   \
+        /* Chi */                                                           \
+        for(j = 0; j < 25; j += 5) {                                        \
+            for(i = 0; i < 5; i++)                                          \
+                bc[i] = a[j + i];                                           \
+            for(i = 0; i < 5; i++)                                          \
+                a[j + i] = XOR(a[j + i],                                    \
+                               ANDNOT(bc[(i + 1) % 5], bc[(i + 2) % 5]));   \
+        }                                                                   \
+        /* Iota */                                                          \
+        a[0] = XOR(a[0], SET1(keccakf_rndc[round]));                        \
+    }                                                                       \
+                                                                            \
+    for(i = 0; i < 25; i++)                                                 \
+        STORE(state + i * (LANES), a[i]);
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SHA3_HAVE_SIMD_LANES
+#include <immintrin.h>
+
+#define SHA3_AVX2 __attribute__((target("avx2")))
+#define SHA3_AVX512 __attribute__((target("avx512f")))
+
+static SHA3_AVX2 inline __m256i
+sha3_rotl_avx2(__m256i x, unsigned n)
+{
+    return _mm256_or_si256(_mm256_sll_epi64(x, _mm_cvtsi32_si128((int) n)),
+                           _mm256_srl_epi64(x, _mm_cvtsi32_si128((int) (64 - n))));
+}
+
+#define SHA3_AVX2_LOAD(p) _mm256_loadu_si256((const __m256i *) (p))
+#define SHA3_AVX2_STORE(p, v) _mm256_storeu_si256((__m256i *) (p), (v))
+#define SHA3_AVX2_SET1(x) _mm256_set1_epi64x((long long) (x))
+
+static SHA3_AVX2 void
+keccakf_x4_avx2(uint64_t *state)
+{
+    SHA3_KECCAKF_LANES_BODY(__m256i, 4, SHA3_AVX2_LOAD, SHA3_AVX2_STORE,
+                            _mm256_xor_si256, _mm256_andnot_si256,
+                            sha3_rotl_avx2, SHA3_AVX2_SET1)
+}
+
+#define SHA3_AVX512_ROTL(x, n) _mm512_rolv_epi64((x), _mm512_set1_epi64(n))
+#define SHA3_AVX512_SET1(x) _mm512_set1_epi64((long long) (x))
+
+static SHA3_AVX512 void
+keccakf_x8_avx512(uint64_t *state)
+{
+    SHA3_KECCAKF_LANES_BODY(__m512i, 8, _mm512_loadu_si512,
+                            _mm512_storeu_si512, _mm512_xor_si512,
+                            _mm512_andnot_si512, SHA3_AVX512_ROTL,
+                            SHA3_AVX512_SET1)
+}
+#endif
+
+/* Picks the widest permutation the running CPU can execute.
+ * Returns number of lanes, or 1 when only the scalar path is available. */
+static unsigned
+sha3_select_lanes(sha3_keccakf_lanes_fn *permute)
+{
+#ifdef SHA3_HAVE_SIMD_LANES
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")) {
+        *permute = keccakf_x8_avx512;
+        return 8;
+    }
+    if(__builtin_cpu_supports("avx2")) {
+        *permute = keccakf_x4_avx2;
+        return 4;
+    }
+#endif
+    *permute = NULL;
+    return 1;
+}
+
+static uint64_t
+sha3_load64_le(const uint8_t *p)
+{
+    return (uint64_t) (p[0]) | ((uint64_t) (p[1]) << 8 * 1) |
+    ((uint64_t) (p[2]) << 8 * 2) | ((uint64_t) (p[3]) << 8 * 3) |
+    ((uint64_t) (p[4]) << 8 * 4) | ((uint64_t) (p[5]) << 8 * 5) |
+    ((uint64_t) (p[6]) << 8 * 6) | ((uint64_t) (p[7]) << 8 * 7);
+}
+
+static void
+sha3_store64_le(uint8_t *p, uint64_t v)
+{
+    unsigned i;
+    for(i = 0; i < 8; i++)
+        p[i] = (uint8_t) (v >> (8 * i));
+}
+
+/* Hashes up to `lanes` messages in lockstep. Messages of different length
+ * need different number of permutations: the digest of each lane is taken
+ * right after its last block, later permutations of that lane are ignored. */
+static void
+sha3_256_lanes(sha3_keccakf_lanes_fn permute, unsigned lanes,
+               const unsigned char *const *messages,
+               const size_t *message_lens, unsigned count, unsigned char *out)
+{
+    uint64_t state[SHA3_KECCAK_SPONGE_WORDS * SHA3_MAX_LANES];
+    uint8_t last[SHA3_256_RATE_BYTES];
+    size_t blocks[SHA3_MAX_LANES];
+    size_t max_blocks = 0;
+    size_t b;
+    unsigned lane, w;
+
+    SHA3_ASSERT(count <= lanes && lanes <= SHA3_MAX_LANES);
+
+    memset(state, 0, sizeof(state));
+    for(lane = 0; lane < count; lane++) {
+        /* padding always takes at least one byte */
+        blocks[lane] = message_lens[lane] / SHA3_256_RATE_BYTES + 1;
+        if(blocks[lane] > max_blocks)
+            max_blocks = blocks[lane];
+    }
+
+    for(b = 0; b < max_blocks; b++) {
+        for(lane = 0; lane < count; lane++) {
+            const uint8_t *src;
+            if(b >= blocks[lane])
+                continue;
+            if(b + 1 < blocks[lane]) {
+                src = messages[lane] + b * SHA3_256_RATE_BYTES;
+            } else {
+                /* final block: tail of the message, SHA3 suffix and padding */
+                size_t tail = message_lens[lane] - b * SHA3_256_RATE_BYTES;
+                memset(last, 0, sizeof(last));
+                if(tail)
+                    memcpy(last, messages[lane] + b * SHA3_256_RATE_BYTES, tail);
+                last[tail] ^= 0x06;
+                last[SHA3_256_RATE_BYTES - 1] ^= 0x80;
+                src = last;
+            }
+            for(w = 0; w < SHA3_256_RATE_WORDS; w++)
+                state[w * lanes + lane] ^= sha3_load64_le(src + w * 8);
+        }
+
+        permute(state);
+
+        for(lane = 0; lane < count; lane++) {
+            if(b + 1 != blocks[lane])
+                continue;
+            for(w = 0; w < 4; w++)
+                sha3_store64_le(out + lane * 32 + w * 8, state[w * lanes + lane]);
+        }
+    }
+}
+
+void sha3_256_batch(const unsigned char *const *messages,
+                    const size_t *message_lens,
+                    size_t count,
+                    unsigned char *out) {
+    sha3_keccakf_lanes_fn permute;
+    unsigned lanes = sha3_select_lanes(&permute);
+
+    /* a single message is cheaper on the scalar path */
+    while(permute && count >= 2) {
+        unsigned n = count < lanes ? (unsigned) count : lanes;
+        sha3_256_lanes(permute, lanes, messages, message_lens, n, out);
+        messages += n;
+        message_lens += n;
+        out += n * 32;
+        count -= n;
+    }
+
+    for(; count; count--) {
+        sha3_256(*messages++, *message_lens++, out);
+        out += 32;
+    }
+}
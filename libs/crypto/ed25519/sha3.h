@@ -50,4 +50,13 @@ void sha3_256(const unsigned char *message, size_t message_len, unsigned char *o
 void sha3_384(const unsigned char *message, size_t message_len, unsigned char *out);
 void sha3_512(const unsigned char *message, size_t message_len, unsigned char *out);
 
+/* Hashes `count` independent messages with SHA3-256 and writes the digests
+ * one after another into `out` (count * 32 bytes). Several Keccak states
+ * are permuted side by side with AVX-512 (8 lanes) or AVX2 (4 lanes) when
+ * the CPU supports it, otherwise every message goes through sha3_256. */
+void sha3_256_batch(const unsigned char *const *messages,
+                    const size_t *message_lens,
+                    size_t count,
+                    unsigned char *out);
+
 #endif
@@ -17,6 +17,8 @@
 
 #include "crypto/hash.hpp"
 
+#include <algorithm>
+
 extern "C" {
 #include <sha3.h>
 }
@@ -36,6 +38,12 @@ namespace sha3 {
                  unsigned char *out) {
     sha3_512(message, message_len, out);
   }
+  void sha3_256_batch_(const unsigned char *const *messages,
+                       const size_t *message_lens,
+                       size_t count,
+                       unsigned char *out) {
+    sha3_256_batch(messages, message_lens, count, out);
+  }
 }
 
 namespace iroha {
@@ -72,6 +80,29 @@ namespace iroha {
     return h;
   }
 
+  std::vector<hash256_t> sha3_256_batch(
+      const std::vector<std::string> &messages) {
+    std::vector<const unsigned char *> data;
+    std::vector<size_t> sizes;
+    data.reserve(messages.size());
+    sizes.reserve(messages.size());
+    for (const auto &msg : messages) {
+      data.push_back(reinterpret_cast<const unsigned char *>(msg.data()));
+      sizes.push_back(msg.size());
+    }
+    std::vector<unsigned char> out(messages.size() * hash256_t::size());
+    sha3::sha3_256_batch_(
+        data.data(), sizes.data(), messages.size(), out.data());
+
+    std::vector<hash256_t> hashes(messages.size());
+    for (size_t i = 0; i < hashes.size(); ++i) {
+      std::copy_n(out.begin() + i * hash256_t::size(),
+                  hash256_t::size(),
+                  hashes[i].begin());
+    }
+    return hashes;
+  }
+
   // TODO: remove factories
   const static model::converters::PbTransactionFactory tx_factory;
   const static model::converters::PbBlockFactory block_factory;
@@ -82,6 +113,15 @@ namespace iroha {
     return hash(pb_dat);
   }
 
+  std::vector<hash256_t> hash(const std::vector<model::Transaction> &txs) {
+    std::vector<std::string> payloads;
+    payloads.reserve(txs.size());
+    for (const auto &tx : txs) {
+      payloads.push_back(tx_factory.serialize(tx).payload().SerializeAsString());
+    }
+    return sha3_256_batch(payloads);
+  }
+
   hash256_t hash(const model::Block &block) {
     auto &&pb_dat = block_factory.serialize(block);
     return hash(pb_dat);
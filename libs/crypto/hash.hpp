@@ -19,6 +19,7 @@
 #define IROHA_HASH_H
 
 #include <common/types.hpp>
+#include <vector>
 #include "model/block.hpp"
 #include "model/query.hpp"
 #include "model/transaction.hpp"
@@ -33,10 +34,27 @@ namespace iroha {
   hash512_t sha3_512(const uint8_t *input, size_t in_size);
   hash512_t sha3_512(const std::string &msg);
 
+  /**
+   * Hash several independent messages at once.
+   * Keccak states are processed side by side with SIMD when available,
+   * result is the same as calling sha3_256 on each message
+   * @param messages - messages to hash
+   * @return digests in the order of messages
+   */
+  std::vector<hash256_t> sha3_256_batch(
+      const std::vector<std::string> &messages);
+
   hash256_t hash(const model::Transaction &tx);
   hash256_t hash(const model::Block &tx);
   hash256_t hash(const model::Query &tx);
 
+  /**
+   * Hash transactions using batched sha3_256
+   * @param txs - transactions to hash
+   * @return hashes in the order of transactions
+   */
+  std::vector<hash256_t> hash(const std::vector<model::Transaction> &txs);
+
 }  // namespace iroha
 
 #endif  // IROHA_HASH_H
@@ -0,0 +1,187 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "crypto/merkle.hpp"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include "crypto/hash.hpp"
+
+namespace iroha {
+
+  namespace {
+    /// Levels with at least this number of parents are hashed in parallel
+    const size_t kParallelThreshold = 1024;
+    /// Number of parents hashed by one task
+    const size_t kParallelGrain = 256;
+
+    // distinct prefixes keep a leaf from being taken for an inner node
+    const char kLeafPrefix = 0x00;
+    const char kNodePrefix = 0x01;
+
+    std::string leafNode(const hash256_t &leaf) {
+      std::string node;
+      node.reserve(1 + leaf.size());
+      node.push_back(kLeafPrefix);
+      node.append(leaf.begin(), leaf.end());
+      return node;
+    }
+
+    std::string concatNodes(const hash256_t &left, const hash256_t &right) {
+      std::string node;
+      node.reserve(1 + left.size() + right.size());
+      node.push_back(kNodePrefix);
+      node.append(left.begin(), left.end());
+      node.append(right.begin(), right.end());
+      return node;
+    }
+
+    hash256_t hashNodes(const hash256_t &left, const hash256_t &right) {
+      return sha3_256(concatNodes(left, right));
+    }
+
+    /**
+     * Hash parents of nodes [2 * begin, 2 * end) into next[begin, end)
+     */
+    void hashParents(const std::vector<hash256_t> &level,
+                     std::vector<hash256_t> &next,
+                     size_t begin,
+                     size_t end) {
+      std::vector<std::string> nodes;
+      nodes.reserve(end - begin);
+      for (auto i = begin; i < end; ++i) {
+        nodes.push_back(concatNodes(level[2 * i], level[2 * i + 1]));
+      }
+      auto hashes = sha3_256_batch(nodes);
+      std::copy(hashes.begin(), hashes.end(), next.begin() + begin);
+    }
+
+    /**
+     * Hash leaves [begin, end) into level[begin, end)
+     */
+    void hashLeaves(const std::vector<hash256_t> &leaves,
+                    std::vector<hash256_t> &level,
+                    size_t begin,
+                    size_t end) {
+      std::vector<std::string> nodes;
+      nodes.reserve(end - begin);
+      for (auto i = begin; i < end; ++i) {
+        nodes.push_back(leafNode(leaves[i]));
+      }
+      auto hashes = sha3_256_batch(nodes);
+      std::copy(hashes.begin(), hashes.end(), level.begin() + begin);
+    }
+
+    std::vector<hash256_t> leafLevel(const std::vector<hash256_t> &leaves) {
+      std::vector<hash256_t> level(leaves.size());
+      if (leaves.size() >= kParallelThreshold) {
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, leaves.size(), kParallelGrain),
+            [&leaves, &level](const tbb::blocked_range<size_t> &range) {
+              hashLeaves(leaves, level, range.begin(), range.end());
+            });
+      } else {
+        hashLeaves(leaves, level, 0, leaves.size());
+      }
+      return level;
+    }
+
+    std::vector<hash256_t> nextLevel(const std::vector<hash256_t> &level) {
+      auto parents = level.size() / 2;
+      std::vector<hash256_t> next(parents + level.size() % 2);
+
+      if (parents >= kParallelThreshold) {
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, parents, kParallelGrain),
+            [&level, &next](const tbb::blocked_range<size_t> &range) {
+              hashParents(level, next, range.begin(), range.end());
+            });
+      } else {
+        hashParents(level, next, 0, parents);
+      }
+
+      if (level.size() % 2 == 1) {
+        next.back() = level.back();
+      }
+      return next;
+    }
+  }  // namespace
+
+  hash256_t merkleRoot(const std::vector<hash256_t> &leaves) {
+    if (leaves.empty()) {
+      return hash256_t{};
+    }
+    auto level = leafLevel(leaves);
+    while (level.size() > 1) {
+      level = nextLevel(level);
+    }
+    return level.front();
+  }
+
+  nonstd::optional<MerkleProof> merkleProof(
+      const std::vector<hash256_t> &leaves, size_t index) {
+    if (index >= leaves.size()) {
+      return nonstd::nullopt;
+    }
+    MerkleProof proof;
+    proof.index = index;
+    proof.leaves_number = leaves.size();
+
+    auto level = leafLevel(leaves);
+    auto position = index;
+    while (level.size() > 1) {
+      auto sibling = position ^ 1;
+      if (sibling < level.size()) {
+        proof.path.push_back(level[sibling]);
+      }
+      level = nextLevel(level);
+      position /= 2;
+    }
+    return proof;
+  }
+
+  bool verifyMerkleProof(const hash256_t &leaf,
+                         const MerkleProof &proof,
+                         const hash256_t &root,
+                         size_t leaves_number) {
+    if (proof.leaves_number != leaves_number
+        or proof.index >= proof.leaves_number) {
+      return false;
+    }
+    auto node = sha3_256(leafNode(leaf));
+    auto position = proof.index;
+    auto level_size = proof.leaves_number;
+    auto sibling = proof.path.begin();
+    while (level_size > 1) {
+      if (position % 2 == 1) {
+        if (sibling == proof.path.end()) {
+          return false;
+        }
+        node = hashNodes(*sibling++, node);
+      } else if (position + 1 < level_size) {
+        if (sibling == proof.path.end()) {
+          return false;
+        }
+        node = hashNodes(node, *sibling++);
+      }
+      position /= 2;
+      level_size = (level_size + 1) / 2;
+    }
+    return sibling == proof.path.end() and node == root;
+  }
+
+}  // namespace iroha
@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_MERKLE_HPP
+#define IROHA_MERKLE_HPP
+
+#include <nonstd/optional.hpp>
+#include <vector>
+#include "common/types.hpp"
+
+namespace iroha {
+
+  /**
+   * Audit path from a leaf to the root of merkle tree.
+   *
+   * Tree is built bottom-up over sha3_256(0x00 || leaf) of every leaf:
+   * nodes are paired from the left, parent is
+   * sha3_256(0x01 || left || right), the last node of a level with odd
+   * number of nodes is moved to the next level unchanged.
+   */
+  struct MerkleProof {
+    /**
+     * Position of the leaf in the lowest level
+     */
+    size_t index{};
+
+    /**
+     * Number of leaves in the tree
+     */
+    size_t leaves_number{};
+
+    /**
+     * Sibling hashes from the leaf level up to the root,
+     * levels where the node has no sibling are skipped
+     */
+    std::vector<hash256_t> path;
+
+    bool operator==(const MerkleProof &rhs) const {
+      return index == rhs.index and leaves_number == rhs.leaves_number
+          and path == rhs.path;
+    }
+  };
+
+  /**
+   * Calculate root of merkle tree. Levels with many nodes are hashed
+   * in parallel
+   * @param leaves - hashes of tree leaves
+   * @return root of the tree, zero hash for empty leaves
+   */
+  hash256_t merkleRoot(const std::vector<hash256_t> &leaves);
+
+  /**
+   * Build audit path for the leaf
+   * @param leaves - hashes of tree leaves
+   * @param index - position of the leaf
+   * @return proof or nullopt if index is out of range
+   */
+  nonstd::optional<MerkleProof> merkleProof(
+      const std::vector<hash256_t> &leaves, size_t index);
+
+  /**
+   * Check that leaf is included in the tree with given root
+   * @param leaf - hash of the leaf
+   * @param proof - audit path of the leaf
+   * @param root - expected root of the tree
+   * @param leaves_number - number of leaves of the tree with given root,
+   * e.g. transactions number of the block, proof is not trusted for it
+   * @return true if the path leads from leaf to root
+   */
+  bool verifyMerkleProof(const hash256_t &leaf,
+                         const MerkleProof &proof,
+                         const hash256_t &root,
+                         size_t leaves_number);
+
+}  // namespace iroha
+
+#endif  // IROHA_MERKLE_HPP
@@ -0,0 +1,154 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "crypto/signer.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+
+#include <tbb/parallel_for.h>
+
+extern "C" {
+#include <ge.h>
+#include <sc.h>
+#include <sha512.h>
+}
+
+namespace iroha {
+
+  namespace {
+    /**
+     * Zero memory in a way the compiler is not allowed to elide
+     */
+    void secureZero(void *data, size_t size) {
+      volatile auto *bytes = static_cast<volatile uint8_t *>(data);
+      while (size--) {
+        *bytes++ = 0;
+      }
+    }
+  }  // namespace
+
+  /**
+   * Secret material of the signer, lives in the locked page
+   */
+  struct Signer::Secret {
+    /**
+     * Clamped secret scalar followed by the nonce prefix,
+     * same layout as privkey_t
+     */
+    uint8_t expanded[64];
+
+    /**
+     * sha512 state after absorbing the nonce prefix
+     */
+    sha512_context prefix;
+  };
+
+  Signer::Signer(const keypair_t &keypair) : pubkey_(keypair.pubkey) {
+    auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    secret_size_ = (sizeof(Secret) + page - 1) / page * page;
+    void *memory = nullptr;
+    if (posix_memalign(&memory, page, secret_size_) != 0) {
+      throw std::bad_alloc();
+    }
+    locked_ = mlock(memory, secret_size_) == 0;
+#ifdef MADV_DONTDUMP
+    madvise(memory, secret_size_, MADV_DONTDUMP);
+#endif
+    secret_ = new (memory) Secret;
+
+    std::copy(keypair.privkey.begin(),
+              keypair.privkey.end(),
+              std::begin(secret_->expanded));
+    sha512_init(&secret_->prefix);
+    sha512_update(&secret_->prefix, secret_->expanded + 32, 32);
+  }
+
+  Signer::~Signer() {
+    secureZero(secret_, secret_size_);
+    if (locked_) {
+      munlock(secret_, secret_size_);
+    }
+    free(secret_);
+  }
+
+  const pubkey_t &Signer::publicKey() const {
+    return pubkey_;
+  }
+
+  bool Signer::locked() const {
+    return locked_;
+  }
+
+  sig_t Signer::sign(const std::string &msg) const {
+    return sign(reinterpret_cast<const uint8_t *>(msg.data()), msg.size());
+  }
+
+  std::vector<sig_t> Signer::sign(
+      const std::vector<std::string> &messages) const {
+    std::vector<sig_t> signatures(messages.size());
+    auto sign_range = [this, &messages, &signatures](size_t begin,
+                                                     size_t end) {
+      for (auto i = begin; i < end; ++i) {
+        signatures[i] = sign(messages[i]);
+      }
+    };
+    if (messages.size() < PARALLEL_BATCH) {
+      sign_range(0, messages.size());
+    } else {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, messages.size()),
+                        [&sign_range](const tbb::blocked_range<size_t> &r) {
+                          sign_range(r.begin(), r.end());
+                        });
+    }
+    return signatures;
+  }
+
+  sig_t Signer::sign(const uint8_t *msg, size_t msgsize) const {
+    // same steps as ed25519_sign, starting from the prepared prefix state
+    sig_t sig;
+    sha512_context hash = secret_->prefix;
+    uint8_t r[64];
+    uint8_t hram[64];
+    ge_p3 R;
+
+    sha512_update(&hash, msg, msgsize);
+    sha512_final(&hash, r);
+    secureZero(&hash, sizeof(hash));
+
+    sc_reduce(r);
+    ge_scalarmult_base(&R, r);
+    ge_p3_tobytes(sig.data(), &R);
+
+    sha512_init(&hash);
+    sha512_update(&hash, sig.data(), 32);
+    sha512_update(&hash, pubkey_.data(), 32);
+    sha512_update(&hash, msg, msgsize);
+    sha512_final(&hash, hram);
+
+    sc_reduce(hram);
+    sc_muladd(sig.data() + 32, hram, secret_->expanded, r);
+
+    secureZero(r, sizeof(r));
+    secureZero(&R, sizeof(R));
+    return sig;
+  }
+}  // namespace iroha
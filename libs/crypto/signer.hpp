@@ -0,0 +1,87 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_SIGNER_HPP
+#define IROHA_SIGNER_HPP
+
+#include <string>
+#include <vector>
+#include "common/types.hpp"
+
+namespace iroha {
+
+  /**
+   * Ed25519 signer bound to a single keypair, intended for the node's own
+   * key which signs every block, vote and query response.
+   *
+   * Secret scalar, nonce prefix and sha512 state with the prefix already
+   * absorbed are prepared once and kept in a page locked with mlock, so they
+   * are never swapped out; the page is zeroized on destruction. Every
+   * signature is byte-equal to iroha::sign with the same keypair.
+   */
+  class Signer {
+   public:
+    explicit Signer(const keypair_t &keypair);
+
+    ~Signer();
+
+    Signer(const Signer &) = delete;
+    Signer &operator=(const Signer &) = delete;
+
+    /**
+     * @return public key of the signer
+     */
+    const pubkey_t &publicKey() const;
+
+    /**
+     * @return true if secret material is locked in memory,
+     * false if mlock was refused (e.g. RLIMIT_MEMLOCK is exceeded)
+     */
+    bool locked() const;
+
+    /**
+     * Sign the message
+     * @param msg - message to sign
+     * @return signature of the message
+     */
+    sig_t sign(const std::string &msg) const;
+
+    /**
+     * Sign a batch of messages, large batches are signed in parallel
+     * @param messages - messages to sign
+     * @return signatures in order of messages
+     */
+    std::vector<sig_t> sign(const std::vector<std::string> &messages) const;
+
+    /**
+     * Minimal number of messages to sign the batch in parallel
+     */
+    static constexpr size_t PARALLEL_BATCH = 16;
+
+   private:
+    sig_t sign(const uint8_t *msg, size_t msgsize) const;
+
+    struct Secret;
+
+    pubkey_t pubkey_;
+    Secret *secret_;
+    size_t secret_size_;
+    bool locked_;
+  };
+}  // namespace iroha
+
+#endif  // IROHA_SIGNER_HPP
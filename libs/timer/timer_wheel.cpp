@@ -0,0 +1,182 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "timer/timer_wheel.hpp"
+
+namespace iroha {
+
+  namespace {
+    constexpr size_t SLOT_BITS = 6;
+    constexpr uint64_t SLOT_MASK = TimerWheel::SLOTS - 1;
+    static_assert(TimerWheel::SLOTS == 1u << SLOT_BITS,
+                  "slots number must match slot bits");
+  }  // namespace
+
+  struct TimerWheel::Entry {
+    Entry(uint64_t deadline, std::function<void()> task)
+        : deadline(deadline), task(std::move(task)) {}
+
+    const uint64_t deadline;
+    std::function<void()> task;
+    std::atomic<bool> cancelled{false};
+  };
+
+  constexpr size_t TimerWheel::SLOTS;
+  constexpr size_t TimerWheel::LEVELS;
+
+  TimerWheel::Handle::Handle(std::weak_ptr<Entry> entry)
+      : entry_(std::move(entry)) {}
+
+  void TimerWheel::Handle::cancel() {
+    if (auto entry = entry_.lock()) {
+      entry->cancelled = true;
+    }
+    entry_.reset();
+  }
+
+  TimerWheel::TimerWheel()
+      : start_(Clock::now()), thread_(&TimerWheel::run, this) {}
+
+  TimerWheel::~TimerWheel() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  TimerWheel::Handle TimerWheel::schedule(std::chrono::milliseconds delay,
+                                          std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // the tick in progress is never reached again, so run at the next one
+    auto ticks = std::max<uint64_t>(delay.count(), 1);
+    auto entry =
+        std::make_shared<Entry>(std::max(elapsed(), tick_) + ticks,
+                                std::move(task));
+    insert(entry);
+    ++size_;
+    cv_.notify_one();
+    return Handle(entry);
+  }
+
+  void TimerWheel::cancelAndWait(Handle &handle) {
+    handle.cancel();
+    if (std::this_thread::get_id() == thread_.get_id()) {
+      return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    // task which passed the cancellation check is counted as started
+    auto started = started_;
+    finished_cv_.wait(lock, [this, started] { return finished_ >= started; });
+  }
+
+  size_t TimerWheel::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+  }
+
+  void TimerWheel::insert(std::shared_ptr<Entry> entry) {
+    auto delta = entry->deadline > tick_ ? entry->deadline - tick_ : 0;
+    for (size_t level = 0; level < LEVELS; ++level) {
+      if (delta < (1ull << (SLOT_BITS * (level + 1)))) {
+        auto slot = (entry->deadline >> (SLOT_BITS * level)) & SLOT_MASK;
+        wheel_[level][slot].push_back(std::move(entry));
+        return;
+      }
+    }
+    // beyond the wheel range: park in the farthest slot of the top level,
+    // entry is placed again when that slot is cascaded
+    auto shift = SLOT_BITS * (LEVELS - 1);
+    auto slot = ((tick_ >> shift) + SLOT_MASK) & SLOT_MASK;
+    wheel_[LEVELS - 1][slot].push_back(std::move(entry));
+  }
+
+  void TimerWheel::advance(Slot &due) {
+    ++tick_;
+    for (auto level = LEVELS - 1; level > 0; --level) {
+      auto shift = SLOT_BITS * level;
+      if ((tick_ & ((1ull << shift) - 1)) != 0) {
+        continue;
+      }
+      Slot cascade;
+      cascade.swap(wheel_[level][(tick_ >> shift) & SLOT_MASK]);
+      for (auto &entry : cascade) {
+        insert(std::move(entry));
+      }
+    }
+
+    Slot current;
+    current.swap(wheel_[0][tick_ & SLOT_MASK]);
+    for (auto &entry : current) {
+      --size_;
+      if (not entry->cancelled) {
+        due.push_back(std::move(entry));
+      }
+    }
+  }
+
+  uint64_t TimerWheel::nextTick() const {
+    for (uint64_t tick = tick_ + 1;; ++tick) {
+      if ((tick & SLOT_MASK) == 0 or not wheel_[0][tick & SLOT_MASK].empty()) {
+        return tick;
+      }
+    }
+  }
+
+  uint64_t TimerWheel::elapsed() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               Clock::now() - start_)
+        .count();
+  }
+
+  void TimerWheel::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (not stop_) {
+      Slot due;
+      for (auto now = elapsed(); tick_ < now;) {
+        advance(due);
+      }
+
+      if (not due.empty()) {
+        for (auto &entry : due) {
+          // checked under the lock, so cancelAndWait sees the task started
+          if (entry->cancelled) {
+            continue;
+          }
+          ++started_;
+          lock.unlock();
+          entry->task();
+          lock.lock();
+          ++finished_;
+          finished_cv_.notify_all();
+        }
+        due.clear();
+        continue;
+      }
+
+      if (size_ == 0) {
+        cv_.wait(lock);
+      } else {
+        cv_.wait_until(lock,
+                       start_ + std::chrono::milliseconds(nextTick()));
+      }
+    }
+  }
+}  // namespace iroha
@@ -0,0 +1,147 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_TIMER_WHEEL_HPP
+#define IROHA_TIMER_WHEEL_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iroha {
+
+  /**
+   * Hierarchical timing wheel served by one dedicated thread.
+   *
+   * Wheel has LEVELS levels of SLOTS slots, slot of level k spans
+   * SLOTS^k ticks of one millisecond. Task is put to the lowest level which
+   * covers its deadline and moved down when the lower level wraps, so
+   * scheduling and cancellation are O(1) and the thread sleeps until the
+   * next non-empty slot.
+   *
+   * Tasks are executed on the wheel thread and must not block, since they
+   * delay every other task of the wheel. Components doing heavy work on
+   * timer, like proposal generation, run it on a wheel of their own.
+   */
+  class TimerWheel {
+   private:
+    struct Entry;
+
+   public:
+    /**
+     * Handle of scheduled task
+     */
+    class Handle {
+     public:
+      Handle() = default;
+
+      /**
+       * Prevent the task from being executed. Has no effect if the task
+       * is already running or done
+       */
+      void cancel();
+
+     private:
+      friend class TimerWheel;
+      explicit Handle(std::weak_ptr<Entry> entry);
+
+      std::weak_ptr<Entry> entry_;
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    TimerWheel();
+
+    ~TimerWheel();
+
+    TimerWheel(const TimerWheel &) = delete;
+    TimerWheel &operator=(const TimerWheel &) = delete;
+
+    /**
+     * Execute task after delay
+     * @param delay - time before execution, rounded up to a tick
+     * @param task - function to execute on the wheel thread
+     * @return handle to cancel the task
+     */
+    Handle schedule(std::chrono::milliseconds delay,
+                    std::function<void()> task);
+
+    /**
+     * Cancel the task and wait until the task running on the wheel thread,
+     * if any, is finished, so the objects used by the task may be
+     * destroyed. Does not wait when called from a task
+     * @param handle - handle of the task to cancel
+     */
+    void cancelAndWait(Handle &handle);
+
+    /**
+     * @return number of tasks waiting in the wheel, cancelled tasks are
+     * counted until their slot is reached
+     */
+    size_t size() const;
+
+    static constexpr size_t SLOTS = 64;
+    static constexpr size_t LEVELS = 4;
+
+   private:
+    using Slot = std::vector<std::shared_ptr<Entry>>;
+
+    /**
+     * Put entry to the slot which covers its deadline, mutex_ must be held
+     */
+    void insert(std::shared_ptr<Entry> entry);
+
+    /**
+     * Advance wheel by one tick, collect entries which are due,
+     * mutex_ must be held
+     */
+    void advance(Slot &due);
+
+    /**
+     * @return tick when the wheel has to wake up next, mutex_ must be held
+     */
+    uint64_t nextTick() const;
+
+    /**
+     * @return ticks elapsed since the wheel was started
+     */
+    uint64_t elapsed() const;
+
+    void run();
+
+    const Clock::time_point start_;
+    uint64_t tick_{0};
+    size_t size_{0};
+    bool stop_{false};
+    // tasks started and finished by the wheel thread
+    uint64_t started_{0};
+    uint64_t finished_{0};
+    std::array<std::array<Slot, SLOTS>, LEVELS> wheel_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable finished_cv_;
+    std::thread thread_;
+  };
+}  // namespace iroha
+
+#endif  // IROHA_TIMER_WHEEL_HPP
@@ -0,0 +1,318 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "framework/network_simulator.hpp"
+
+namespace framework {
+  namespace simulator {
+
+    // ----------| VirtualClock |----------
+
+    uint64_t VirtualClock::now() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return now_;
+    }
+
+    void VirtualClock::schedule(uint64_t delay, Task task) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      events_.push(Event{now_ + delay, seq_++, std::move(task)});
+    }
+
+    bool VirtualClock::step() {
+      Task task;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (events_.empty()) {
+          return false;
+        }
+        now_ = events_.top().time;
+        task = std::move(const_cast<Event &>(events_.top()).task);
+        events_.pop();
+      }
+      task();
+      return true;
+    }
+
+    size_t VirtualClock::runUntil(uint64_t deadline) {
+      size_t executed = 0;
+      while (true) {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (events_.empty() or events_.top().time > deadline) {
+            now_ = std::max(now_, deadline);
+            return executed;
+          }
+        }
+        step();
+        ++executed;
+      }
+    }
+
+    size_t VirtualClock::runUntilIdle() {
+      size_t executed = 0;
+      while (step()) {
+        ++executed;
+      }
+      return executed;
+    }
+
+    size_t VirtualClock::pending() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return events_.size();
+    }
+
+    // ----------| VirtualTimer |----------
+
+    VirtualTimer::VirtualTimer(VirtualClock &clock)
+        : clock_(clock), generation_(std::make_shared<uint64_t>(0)) {}
+
+    void VirtualTimer::invokeAfterDelay(uint64_t millis,
+                                        std::function<void()> handler) {
+      auto generation = ++*generation_;
+      std::weak_ptr<uint64_t> current = generation_;
+      clock_.schedule(millis, [current, generation, handler] {
+        auto value = current.lock();
+        if (value and *value == generation) {
+          handler();
+        }
+      });
+    }
+
+    void VirtualTimer::deny() {
+      ++*generation_;
+    }
+
+    // ----------| NetworkSimulator |----------
+
+    NetworkSimulator::NetworkSimulator(VirtualClock &clock,
+                                       LinkConfig config,
+                                       uint64_t seed)
+        : clock_(clock), config_(config), random_(seed) {}
+
+    void NetworkSimulator::setLink(const std::string &from,
+                                   const std::string &to,
+                                   LinkConfig config) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      links_[from + " " + to] = config;
+    }
+
+    void NetworkSimulator::partition(
+        const std::vector<std::vector<std::string>> &groups) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      groups_.clear();
+      for (size_t i = 0; i < groups.size(); ++i) {
+        for (const auto &address : groups[i]) {
+          groups_[address] = i;
+        }
+      }
+    }
+
+    void NetworkSimulator::heal() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      groups_.clear();
+    }
+
+    bool NetworkSimulator::send(const std::string &from,
+                                const std::string &to,
+                                VirtualClock::Task deliver) {
+      uint64_t delay;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.sent;
+        auto it = links_.find(from + " " + to);
+        const auto &link = it != links_.end() ? it->second : config_;
+        if (not connected(from, to)
+            or std::bernoulli_distribution(link.loss)(random_)) {
+          ++stats_.lost;
+          return false;
+        }
+        delay = link.latency
+            + std::uniform_int_distribution<uint64_t>(0, link.jitter)(random_);
+      }
+      clock_.schedule(delay, std::move(deliver));
+      return true;
+    }
+
+    NetworkSimulator::Stats NetworkSimulator::stats() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return stats_;
+    }
+
+    VirtualClock &NetworkSimulator::clock() {
+      return clock_;
+    }
+
+    bool NetworkSimulator::connected(const std::string &from,
+                                     const std::string &to) const {
+      auto lhs = groups_.find(from);
+      auto rhs = groups_.find(to);
+      return lhs == groups_.end() or rhs == groups_.end()
+          or lhs->second == rhs->second;
+    }
+
+    void NetworkSimulator::bind(
+        const std::string &address,
+        std::weak_ptr<iroha::consensus::yac::YacNetworkNotifications>
+            handler) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      yac_[address] = handler;
+    }
+
+    void NetworkSimulator::bind(
+        const std::string &address,
+        std::weak_ptr<iroha::network::OrderingGateNotification> handler) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      gates_[address] = handler;
+    }
+
+    void NetworkSimulator::bind(
+        const std::string &address,
+        std::weak_ptr<iroha::network::OrderingServiceNotification> handler) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      services_[address] = handler;
+    }
+
+    template <typename Handler>
+    std::shared_ptr<Handler> NetworkSimulator::find(
+        const Endpoints<Handler> &map, const std::string &address) {
+      auto it = map.find(address);
+      return it != map.end() ? it->second.lock() : nullptr;
+    }
+
+    std::shared_ptr<iroha::consensus::yac::YacNetworkNotifications>
+    NetworkSimulator::yac(const std::string &address) const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return find(yac_, address);
+    }
+
+    std::shared_ptr<iroha::network::OrderingGateNotification>
+    NetworkSimulator::gate(const std::string &address) const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return find(gates_, address);
+    }
+
+    std::shared_ptr<iroha::network::OrderingServiceNotification>
+    NetworkSimulator::service(const std::string &address) const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return find(services_, address);
+    }
+
+    // ----------| SimulatedYacNetwork |----------
+
+    SimulatedYacNetwork::SimulatedYacNetwork(NetworkSimulator &network,
+                                             std::string address)
+        : network_(network), address_(std::move(address)) {}
+
+    void SimulatedYacNetwork::subscribe(
+        std::shared_ptr<iroha::consensus::yac::YacNetworkNotifications>
+            handler) {
+      network_.bind(address_, handler);
+    }
+
+    void SimulatedYacNetwork::send_commit(
+        iroha::model::Peer to, iroha::consensus::yac::CommitMessage commit) {
+      auto &network = network_;
+      network_.send(address_, to.address, [&network, to, commit] {
+        if (auto handler = network.yac(to.address)) {
+          handler->on_commit(commit);
+        }
+      });
+    }
+
+    void SimulatedYacNetwork::send_reject(
+        iroha::model::Peer to, iroha::consensus::yac::RejectMessage reject) {
+      auto &network = network_;
+      network_.send(address_, to.address, [&network, to, reject] {
+        if (auto handler = network.yac(to.address)) {
+          handler->on_reject(reject);
+        }
+      });
+    }
+
+    void SimulatedYacNetwork::send_vote(
+        iroha::model::Peer to, iroha::consensus::yac::VoteMessage vote) {
+      auto &network = network_;
+      network_.send(address_, to.address, [&network, to, vote] {
+        if (auto handler = network.yac(to.address)) {
+          handler->on_vote(vote);
+        }
+      });
+    }
+
+    // ----------| SimulatedOrderingGateTransport |----------
+
+    SimulatedOrderingGateTransport::SimulatedOrderingGateTransport(
+        NetworkSimulator &network, std::string address, std::string service)
+        : network_(network),
+          address_(std::move(address)),
+          service_(std::move(service)) {}
+
+    void SimulatedOrderingGateTransport::subscribe(
+        std::shared_ptr<iroha::network::OrderingGateNotification> subscriber) {
+      network_.bind(address_, subscriber);
+    }
+
+    void SimulatedOrderingGateTransport::propagate_transaction(
+        std::shared_ptr<const iroha::model::Transaction> transaction) {
+      auto &network = network_;
+      auto service = service_;
+      network_.send(address_, service_, [&network, service, transaction] {
+        if (auto handler = network.service(service)) {
+          handler->onTransaction(*transaction);
+        }
+      });
+    }
+
+    size_t SimulatedOrderingGateTransport::queueDepth() const {
+      auto handler = network_.service(service_);
+      return handler ? handler->queueDepth() : 0;
+    }
+
+    bool SimulatedOrderingGateTransport::overloaded() const {
+      auto handler = network_.service(service_);
+      return handler and handler->queueFull();
+    }
+
+    // ----------| SimulatedOrderingServiceTransport |----------
+
+    SimulatedOrderingServiceTransport::SimulatedOrderingServiceTransport(
+        NetworkSimulator &network, std::string address)
+        : network_(network), address_(std::move(address)) {}
+
+    void SimulatedOrderingServiceTransport::subscribe(
+        std::shared_ptr<iroha::network::OrderingServiceNotification>
+            subscriber) {
+      network_.bind(address_, subscriber);
+    }
+
+    void SimulatedOrderingServiceTransport::publishProposal(
+        iroha::model::Proposal &&proposal,
+        const std::vector<std::string> &peers) {
+      auto shared = std::make_shared<const iroha::model::Proposal>(
+          std::move(proposal));
+      auto &network = network_;
+      for (const auto &peer : peers) {
+        network_.send(address_, peer, [&network, peer, shared] {
+          if (auto handler = network.gate(peer)) {
+            handler->onProposal(*shared);
+          }
+        });
+      }
+    }
+
+  }  // namespace simulator
+}  // namespace framework
@@ -0,0 +1,325 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_NETWORK_SIMULATOR_HPP
+#define IROHA_NETWORK_SIMULATOR_HPP
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "consensus/yac/timer.hpp"
+#include "consensus/yac/transport/yac_network_interface.hpp"
+#include "network/ordering_gate_transport.hpp"
+#include "network/ordering_service_transport.hpp"
+
+namespace framework {
+  namespace simulator {
+
+    /**
+     * Virtual time of simulation in milliseconds. Tasks are executed on the
+     * thread which runs the clock in order of their time, tasks of the same
+     * time in order of scheduling, so a simulation is reproducible
+     */
+    class VirtualClock {
+     public:
+      using Task = std::function<void()>;
+
+      /**
+       * @return current virtual time
+       */
+      uint64_t now() const;
+
+      /**
+       * Execute task after delay of virtual time
+       * @param delay - milliseconds from now
+       * @param task - function to execute
+       */
+      void schedule(uint64_t delay, Task task);
+
+      /**
+       * Advance time to the next task and execute it
+       * @return false if there are no tasks
+       */
+      bool step();
+
+      /**
+       * Execute tasks which are due not later than deadline,
+       * time is advanced to the deadline
+       * @param deadline - virtual time to stop at
+       * @return number of executed tasks
+       */
+      size_t runUntil(uint64_t deadline);
+
+      /**
+       * Execute tasks until there are none
+       * @return number of executed tasks
+       */
+      size_t runUntilIdle();
+
+      /**
+       * @return number of scheduled tasks
+       */
+      size_t pending() const;
+
+     private:
+      struct Event {
+        uint64_t time;
+        uint64_t seq;
+        Task task;
+
+        bool operator>(const Event &rhs) const {
+          return time != rhs.time ? time > rhs.time : seq > rhs.seq;
+        }
+      };
+
+      uint64_t now_{0};
+      uint64_t seq_{0};
+      std::priority_queue<Event, std::vector<Event>, std::greater<Event>>
+          events_;
+      mutable std::mutex mutex_;
+    };
+
+    /**
+     * Consensus timer over virtual clock. As TimerImpl, a new invocation
+     * replaces the pending one
+     */
+    class VirtualTimer : public iroha::consensus::yac::Timer {
+     public:
+      explicit VirtualTimer(VirtualClock &clock);
+
+      void invokeAfterDelay(uint64_t millis,
+                            std::function<void()> handler) override;
+
+      void deny() override;
+
+     private:
+      VirtualClock &clock_;
+
+      /**
+       * Generation of the pending invocation, shared with scheduled tasks
+       * which may outlive the timer
+       */
+      std::shared_ptr<uint64_t> generation_;
+    };
+
+    /**
+     * Properties of links between peers
+     */
+    struct LinkConfig {
+      /// minimal delivery time in milliseconds
+      uint64_t latency = 1;
+      /// maximal random addition to latency in milliseconds
+      uint64_t jitter = 0;
+      /// probability of message loss
+      double loss = 0.;
+    };
+
+    /**
+     * In-memory network between peers identified by addresses. Messages are
+     * delivered over virtual clock with delay and loss of their link, random
+     * values are taken from a generator with the given seed
+     */
+    class NetworkSimulator {
+     public:
+      /**
+       * @param clock - clock of simulation
+       * @param config - properties of all links
+       * @param seed - seed of random generator
+       */
+      explicit NetworkSimulator(VirtualClock &clock,
+                                LinkConfig config = LinkConfig(),
+                                uint64_t seed = 0);
+
+      /**
+       * Set properties of the link from one peer to another
+       */
+      void setLink(const std::string &from,
+                   const std::string &to,
+                   LinkConfig config);
+
+      /**
+       * Split peers into groups, messages between peers of different groups
+       * are lost. Peers absent in groups reach everyone. Messages in flight
+       * are delivered
+       * @param groups - addresses of peers in each group
+       */
+      void partition(const std::vector<std::vector<std::string>> &groups);
+
+      /**
+       * Remove partition
+       */
+      void heal();
+
+      /**
+       * Send message over the link
+       * @param from - address of sender
+       * @param to - address of recipient
+       * @param deliver - function which delivers message to recipient
+       * @return false if message is lost
+       */
+      bool send(const std::string &from,
+                const std::string &to,
+                VirtualClock::Task deliver);
+
+      /**
+       * Statistics of sent messages
+       */
+      struct Stats {
+        size_t sent = 0;
+        size_t lost = 0;
+      };
+
+      Stats stats() const;
+
+      VirtualClock &clock();
+
+      // ------|Endpoints|------
+
+      void bind(const std::string &address,
+                std::weak_ptr<iroha::consensus::yac::YacNetworkNotifications>
+                    handler);
+      void bind(const std::string &address,
+                std::weak_ptr<iroha::network::OrderingGateNotification>
+                    handler);
+      void bind(const std::string &address,
+                std::weak_ptr<iroha::network::OrderingServiceNotification>
+                    handler);
+
+      std::shared_ptr<iroha::consensus::yac::YacNetworkNotifications> yac(
+          const std::string &address) const;
+      std::shared_ptr<iroha::network::OrderingGateNotification> gate(
+          const std::string &address) const;
+      std::shared_ptr<iroha::network::OrderingServiceNotification> service(
+          const std::string &address) const;
+
+     private:
+      template <typename Handler>
+      using Endpoints =
+          std::unordered_map<std::string, std::weak_ptr<Handler>>;
+
+      template <typename Handler>
+      static std::shared_ptr<Handler> find(const Endpoints<Handler> &map,
+                                           const std::string &address);
+
+      bool connected(const std::string &from, const std::string &to) const;
+
+      VirtualClock &clock_;
+      const LinkConfig config_;
+      std::mt19937_64 random_;
+      std::unordered_map<std::string, LinkConfig> links_;
+      std::unordered_map<std::string, size_t> groups_;
+      Stats stats_;
+
+      Endpoints<iroha::consensus::yac::YacNetworkNotifications> yac_;
+      Endpoints<iroha::network::OrderingGateNotification> gates_;
+      Endpoints<iroha::network::OrderingServiceNotification> services_;
+      mutable std::mutex mutex_;
+    };
+
+    /**
+     * Consensus transport of a peer over simulated network
+     */
+    class SimulatedYacNetwork : public iroha::consensus::yac::YacNetwork {
+     public:
+      SimulatedYacNetwork(NetworkSimulator &network, std::string address);
+
+      void subscribe(
+          std::shared_ptr<iroha::consensus::yac::YacNetworkNotifications>
+              handler) override;
+      void send_commit(iroha::model::Peer to,
+                       iroha::consensus::yac::CommitMessage commit) override;
+      void send_reject(iroha::model::Peer to,
+                       iroha::consensus::yac::RejectMessage reject) override;
+      void send_vote(iroha::model::Peer to,
+                     iroha::consensus::yac::VoteMessage vote) override;
+
+     private:
+      NetworkSimulator &network_;
+      const std::string address_;
+    };
+
+    /**
+     * Ordering gate transport of a peer over simulated network
+     */
+    class SimulatedOrderingGateTransport
+        : public iroha::network::OrderingGateTransport {
+     public:
+      /**
+       * @param network - simulated network
+       * @param address - address of the peer
+       * @param service - address of ordering service
+       */
+      SimulatedOrderingGateTransport(NetworkSimulator &network,
+                                     std::string address,
+                                     std::string service);
+
+      void subscribe(
+          std::shared_ptr<iroha::network::OrderingGateNotification> subscriber)
+          override;
+
+      void propagate_transaction(
+          std::shared_ptr<const iroha::model::Transaction> transaction)
+          override;
+
+      /**
+       * @return queue depth of ordering service, read without delay
+       */
+      size_t queueDepth() const override;
+
+      /**
+       * @return whether the queue of ordering service is full, read without
+       * delay
+       */
+      bool overloaded() const override;
+
+     private:
+      NetworkSimulator &network_;
+      const std::string address_;
+      const std::string service_;
+    };
+
+    /**
+     * Ordering service transport over simulated network
+     */
+    class SimulatedOrderingServiceTransport
+        : public iroha::network::OrderingServiceTransport {
+     public:
+      SimulatedOrderingServiceTransport(NetworkSimulator &network,
+                                        std::string address);
+
+      void subscribe(
+          std::shared_ptr<iroha::network::OrderingServiceNotification>
+              subscriber) override;
+
+      void publishProposal(iroha::model::Proposal &&proposal,
+                           const std::vector<std::string> &peers) override;
+
+     private:
+      NetworkSimulator &network_;
+      const std::string address_;
+    };
+
+  }  // namespace simulator
+}  // namespace framework
+
+#endif  // IROHA_NETWORK_SIMULATOR_HPP
@@ -0,0 +1,255 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "framework/network_simulator.hpp"
+
+using namespace framework::simulator;
+using namespace iroha::consensus::yac;
+
+namespace {
+  class YacHandler : public YacNetworkNotifications {
+   public:
+    void on_commit(CommitMessage commit) override { ++commits; }
+    void on_reject(RejectMessage reject) override { ++rejects; }
+    void on_vote(VoteMessage vote) override { ++votes; }
+
+    size_t commits = 0, rejects = 0, votes = 0;
+  };
+
+  class GateHandler : public iroha::network::OrderingGateNotification {
+   public:
+    void onProposal(iroha::model::Proposal proposal) override {
+      proposals.push_back(proposal.height);
+    }
+
+    std::vector<uint64_t> proposals;
+  };
+
+  class ServiceHandler : public iroha::network::OrderingServiceNotification {
+   public:
+    void onTransaction(const iroha::model::Transaction &) override {
+      ++transactions;
+    }
+
+    size_t queueDepth() const override { return transactions; }
+
+    bool queueFull() const override { return false; }
+
+    size_t transactions = 0;
+  };
+
+  iroha::model::Peer peer(const std::string &address) {
+    iroha::model::Peer result;
+    result.address = address;
+    return result;
+  }
+
+  /**
+   * Send messages from a to b and collect times of delivery
+   */
+  std::vector<uint64_t> deliveryTimes(NetworkSimulator &network,
+                                      size_t messages) {
+    std::vector<uint64_t> times;
+    auto &clock = network.clock();
+    for (size_t i = 0; i < messages; ++i) {
+      network.send("a", "b", [&] { times.push_back(clock.now()); });
+    }
+    clock.runUntilIdle();
+    return times;
+  }
+}  // namespace
+
+/**
+ * @given clock with tasks scheduled in mixed order
+ * @when clock is run
+ * @then tasks are executed in order of time, then of scheduling
+ */
+TEST(VirtualClockTest, TasksExecutedInTimeOrder) {
+  VirtualClock clock;
+  std::vector<std::string> order;
+  clock.schedule(30, [&] { order.push_back("30"); });
+  clock.schedule(10, [&] { order.push_back("10a"); });
+  clock.schedule(10, [&] {
+    order.push_back("10b");
+    clock.schedule(5, [&] { order.push_back("15"); });
+  });
+
+  ASSERT_EQ(4, clock.runUntilIdle());
+  ASSERT_EQ(std::vector<std::string>({"10a", "10b", "15", "30"}), order);
+  ASSERT_EQ(30, clock.now());
+}
+
+/**
+ * @given clock with tasks before and after deadline
+ * @when clock is run until deadline
+ * @then only due tasks are executed and time is at the deadline
+ */
+TEST(VirtualClockTest, RunUntilStopsAtDeadline) {
+  VirtualClock clock;
+  size_t executed = 0;
+  clock.schedule(10, [&] { ++executed; });
+  clock.schedule(50, [&] { ++executed; });
+
+  ASSERT_EQ(1, clock.runUntil(20));
+  ASSERT_EQ(1, executed);
+  ASSERT_EQ(20, clock.now());
+  ASSERT_EQ(1, clock.pending());
+}
+
+/**
+ * @given timer with pending invocation
+ * @when it is replaced by another one and then denied
+ * @then only the latest invocation is executed before deny
+ */
+TEST(VirtualClockTest, TimerInvocationIsReplacedAndDenied) {
+  VirtualClock clock;
+  VirtualTimer timer(clock);
+  std::vector<int> invoked;
+  timer.invokeAfterDelay(10, [&] { invoked.push_back(1); });
+  timer.invokeAfterDelay(20, [&] { invoked.push_back(2); });
+  clock.runUntilIdle();
+  ASSERT_EQ(std::vector<int>({2}), invoked);
+
+  timer.invokeAfterDelay(10, [&] { invoked.push_back(3); });
+  timer.deny();
+  clock.runUntilIdle();
+  ASSERT_EQ(std::vector<int>({2}), invoked);
+}
+
+/**
+ * @given link with latency and jitter
+ * @when messages are sent
+ * @then each is delivered within latency plus jitter
+ */
+TEST(NetworkSimulatorTest, DeliveryWithinLatencyAndJitter) {
+  VirtualClock clock;
+  NetworkSimulator network(clock, LinkConfig{10, 5, 0.});
+
+  auto times = deliveryTimes(network, 100);
+  ASSERT_EQ(100, times.size());
+  for (auto time : times) {
+    ASSERT_GE(time, 10);
+    ASSERT_LE(time, 15);
+  }
+}
+
+/**
+ * @given two simulations with the same seed
+ * @when the same messages are sent
+ * @then they are delivered at the same times
+ */
+TEST(NetworkSimulatorTest, SameSeedGivesSameSchedule) {
+  VirtualClock clock1, clock2;
+  NetworkSimulator network1(clock1, LinkConfig{10, 50, .1}, 42);
+  NetworkSimulator network2(clock2, LinkConfig{10, 50, .1}, 42);
+
+  ASSERT_EQ(deliveryTimes(network1, 100), deliveryTimes(network2, 100));
+}
+
+/**
+ * @given lossy link
+ * @when many messages are sent
+ * @then about the configured share is lost
+ */
+TEST(NetworkSimulatorTest, LossyLinkDropsMessages) {
+  VirtualClock clock;
+  NetworkSimulator network(clock);
+  network.setLink("a", "b", LinkConfig{1, 0, .3});
+
+  auto delivered = deliveryTimes(network, 1000).size();
+  ASSERT_EQ(1000 - delivered, network.stats().lost);
+  ASSERT_NEAR(700, delivered, 60);
+  // reverse direction keeps default config
+  ASSERT_TRUE(network.send("b", "a", [] {}));
+}
+
+/**
+ * @given partitioned network
+ * @when messages are sent between and within groups
+ * @then messages between groups are lost until partition is healed
+ */
+TEST(NetworkSimulatorTest, PartitionSeparatesGroups) {
+  VirtualClock clock;
+  NetworkSimulator network(clock);
+  network.partition({{"a"}, {"b", "c"}});
+
+  ASSERT_FALSE(network.send("a", "b", [] {}));
+  ASSERT_TRUE(network.send("b", "c", [] {}));
+  ASSERT_TRUE(network.send("a", "d", [] {}));
+
+  network.heal();
+  ASSERT_TRUE(network.send("a", "b", [] {}));
+}
+
+/**
+ * @given consensus transports of two peers
+ * @when messages are sent from one peer to another
+ * @then they are handled by subscriber of recipient after latency
+ */
+TEST(NetworkSimulatorTest, YacMessagesReachRecipient) {
+  VirtualClock clock;
+  NetworkSimulator network(clock, LinkConfig{7, 0, 0.});
+  SimulatedYacNetwork sender(network, "a"), recipient(network, "b");
+  auto handler = std::make_shared<YacHandler>();
+  recipient.subscribe(handler);
+
+  sender.send_vote(peer("b"), VoteMessage());
+  sender.send_commit(peer("b"), CommitMessage());
+  sender.send_reject(peer("b"), RejectMessage());
+  // unknown peer
+  sender.send_vote(peer("c"), VoteMessage());
+  clock.runUntilIdle();
+
+  ASSERT_EQ(1, handler->votes);
+  ASSERT_EQ(1, handler->commits);
+  ASSERT_EQ(1, handler->rejects);
+  ASSERT_EQ(7, clock.now());
+}
+
+/**
+ * @given ordering service and gates of two peers
+ * @when transaction is propagated and proposal is published
+ * @then service receives transaction and every gate receives proposal
+ */
+TEST(NetworkSimulatorTest, OrderingMessagesReachRecipients) {
+  VirtualClock clock;
+  NetworkSimulator network(clock);
+  SimulatedOrderingServiceTransport service(network, "s");
+  SimulatedOrderingGateTransport gate1(network, "a", "s"),
+      gate2(network, "b", "s");
+  auto service_handler = std::make_shared<ServiceHandler>();
+  auto gate_handler1 = std::make_shared<GateHandler>();
+  auto gate_handler2 = std::make_shared<GateHandler>();
+  service.subscribe(service_handler);
+  gate1.subscribe(gate_handler1);
+  gate2.subscribe(gate_handler2);
+
+  gate1.propagate_transaction(
+      std::make_shared<const iroha::model::Transaction>());
+  clock.runUntilIdle();
+  ASSERT_EQ(1, service_handler->transactions);
+  ASSERT_EQ(1, gate2.queueDepth());
+
+  iroha::model::Proposal proposal({});
+  proposal.height = 3;
+  service.publishProposal(std::move(proposal), {"a", "b"});
+  clock.runUntilIdle();
+  ASSERT_EQ(std::vector<uint64_t>({3}), gate_handler1->proposals);
+  ASSERT_EQ(std::vector<uint64_t>({3}), gate_handler2->proposals);
+}
@@ -78,8 +78,11 @@ class ClientServerTest : public testing::Test {
                                                                    svMock);
       auto pb_tx_factory =
           std::make_shared<iroha::model::converters::PbTransactionFactory>();
+      auto ordering_gate = std::make_shared<MockOrderingGate>();
+      EXPECT_CALL(*ordering_gate, queueDepth()).WillRepeatedly(Return(0));
+      EXPECT_CALL(*ordering_gate, overloaded()).WillRepeatedly(Return(false));
       auto command_service = std::make_unique<torii::CommandService>(
-          pb_tx_factory, tx_processor, storageMock);
+          pb_tx_factory, tx_processor, storageMock, ordering_gate);
 
       //----------- Query Service ----------
       auto qpf = std::make_unique<iroha::model::QueryProcessingFactory>(
@@ -66,7 +66,8 @@ class ConsensusSunnyDayTest : public ::testing::Test {
   void SetUp() override {
     network = std::make_shared<NetworkImpl>();
     crypto = std::make_shared<FixedCryptoProvider>(std::to_string(my_num));
-    timer = std::make_shared<TimerImpl>();
+    timer = std::make_shared<TimerImpl>(
+        std::make_shared<iroha::TimerWheel>());
     yac = Yac::create(YacVoteStorage(),
                       network,
                       crypto,
@@ -97,7 +98,8 @@ class ConsensusSunnyDayTest : public ::testing::Test {
   }
 
   void TearDown() override {
-    server->Shutdown();
+    // cancel consensus streams instead of waiting for them
+    server->Shutdown(std::chrono::system_clock::now());
     if (thread.joinable()) {
       thread.join();
     }
@@ -142,7 +144,7 @@ TEST_F(ConsensusSunnyDayTest, SunnyDayTest) {
   // Wait for other peers to start
   std::this_thread::sleep_for(std::chrono::milliseconds(delay_before));
 
-  YacHash my_hash("proposal_hash", "block_hash");
+  YacHash my_hash(mk_hash("proposal_hash"), mk_hash("block_hash"));
   yac->vote(my_hash, ClusterOrdering(default_peers));
   std::this_thread::sleep_for(std::chrono::milliseconds(delay_after));
 
@@ -68,8 +68,15 @@ class TransferAssetInterDomainTest : public TxPipelineIntegrationTestFixture {
                                           10001,
                                           10,
                                           5000ms,
+                                          10000,
+                                          {},
+                                          "",
+                                          false,
                                           5000ms,
                                           5000ms,
+                                          0,
+                                          0,
+                                          0,
                                           keypair);
     ASSERT_TRUE(irohad->storage);
 
@@ -20,6 +20,7 @@
 
 #include "crypto/hash.hpp"
 #include "crypto/keys_manager_impl.hpp"
+#include "crypto/merkle.hpp"
 #include "datetime/time.hpp"
 #include "framework/test_subscriber.hpp"
 #include "main/application.hpp"
@@ -42,8 +43,15 @@ class TestIrohad : public Irohad {
              size_t internal_port,
              size_t max_proposal_size,
              std::chrono::milliseconds proposal_delay,
+             size_t max_queue_size,
+             const std::vector<iroha::ordering::LaneConfig> &ordering_lanes,
+             const std::string &ordering_wal_path,
+             bool compact_proposals,
              std::chrono::milliseconds vote_delay,
              std::chrono::milliseconds load_delay,
+             size_t vote_fanout,
+             size_t validation_workers,
+             size_t ordering_partitions,
              const iroha::keypair_t &keypair)
       : Irohad(block_store_dir,
                redis_host,
@@ -53,8 +61,15 @@ class TestIrohad : public Irohad {
                internal_port,
                max_proposal_size,
                proposal_delay,
+               max_queue_size,
+               ordering_lanes,
+               ordering_wal_path,
+               compact_proposals,
                vote_delay,
                load_delay,
+               vote_fanout,
+               validation_workers,
+               ordering_partitions,
                keypair) {}
 
   auto &getCommandService() {
@@ -109,7 +124,8 @@ class TxPipelineIntegrationTestFixture
     expected_block.transactions = transactions;
     expected_block.txs_number = transactions.size();
     expected_block.created_ts = 0;
-    expected_block.merkle_root.fill(0);
+    expected_block.merkle_root =
+        iroha::merkleRoot(iroha::hash(expected_block.transactions));
     expected_block.hash = iroha::hash(expected_block);
     irohad->getCryptoProvider()->sign(expected_block);
 
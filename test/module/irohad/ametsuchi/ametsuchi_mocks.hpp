@@ -110,6 +110,8 @@ namespace iroha {
       MOCK_METHOD1(
           getTxByHashSync,
           boost::optional<model::Transaction>(const std::string &hash));
+      MOCK_METHOD1(getBlockByTxHashSync,
+                   boost::optional<model::Block>(const std::string &hash));
       MOCK_METHOD2(
           getAccountAssetTransactions,
           rxcpp::observable<model::Transaction>(const std::string &account_id,
@@ -128,6 +130,17 @@ namespace iroha {
       MOCK_METHOD0(createTemporaryWsv, std::unique_ptr<TemporaryWsv>());
     };
 
+    class MockTemporaryWsv : public TemporaryWsv {
+     public:
+      MOCK_METHOD2(
+          apply,
+          bool(const model::Transaction &,
+               std::function<bool(const model::Transaction &, WsvQuery &)>));
+      MOCK_METHOD1(replay, bool(const WriteSet &));
+      MOCK_CONST_METHOD0(writeSet, const WriteSet &());
+      MOCK_METHOD0(reset, void());
+    };
+
     class MockMutableStorage : public MutableStorage {
      public:
       MOCK_METHOD2(
@@ -135,6 +148,12 @@ namespace iroha {
           bool(const model::Block &,
                std::function<bool(
                    const model::Block &, WsvQuery &, const hash256_t &)>));
+      MOCK_METHOD3(
+          replay,
+          bool(const model::Block &,
+               const WriteSet &,
+               std::function<bool(
+                   const model::Block &, WsvQuery &, const hash256_t &)>));
     };
 
     /**
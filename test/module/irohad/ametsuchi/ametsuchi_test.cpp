@@ -249,6 +249,42 @@ TEST_F(AmetsuchiTest, PeerTest) {
   ASSERT_EQ(peers->at(0).address, addPeer.address);
 }
 
+/**
+ * @given write set with peer insertion
+ * @when block is applied by replaying the write set
+ * @then peer is inserted without block execution
+ */
+TEST_F(AmetsuchiTest, ReplayWriteSetTest) {
+  auto storage =
+      StorageImpl::create(block_store_path, redishost_, redisport_, pgopt_);
+  ASSERT_TRUE(storage);
+  auto wsv = storage->getWsvQuery();
+
+  Peer peer;
+  peer.pubkey.at(0) = 1;
+  peer.address = "192.168.0.1:50051";
+  WriteSet write_set = {
+      [peer](WsvCommand &command) { return command.insertPeer(peer); }};
+
+  Block block;
+  block.height = 1;
+
+  {
+    auto ms = storage->createMutableStorage();
+    auto replayed = ms->replay(
+        block, write_set, [](const auto &, auto &, const auto &) {
+          return true;
+        });
+    ASSERT_TRUE(replayed);
+    storage->commit(std::move(ms));
+  }
+
+  auto peers = wsv->getPeers();
+  ASSERT_TRUE(peers);
+  ASSERT_EQ(peers->size(), 1);
+  ASSERT_EQ(peers->at(0), peer);
+}
+
 TEST_F(AmetsuchiTest, queryGetAccountAssetTransactionsTest) {
   auto storage =
       StorageImpl::create(block_store_path, redishost_, redisport_, pgopt_);
@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "ametsuchi/impl/recording_wsv_command.hpp"
+#include "ametsuchi/write_set_cache.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+
+using namespace iroha;
+using namespace iroha::ametsuchi;
+
+using ::testing::Return;
+using ::testing::_;
+
+/**
+ * @given recording command over wsv
+ * @when one command succeeds and another fails
+ * @then only successful command is recorded and replayed
+ */
+TEST(WriteSetTest, OnlySuccessfulChangesRecorded) {
+  MockWsvCommand wsv;
+  WriteSet write_set;
+  RecordingWsvCommand recording(wsv, write_set);
+
+  EXPECT_CALL(wsv, insertRole("admin")).WillOnce(Return(true));
+  EXPECT_CALL(wsv, insertRole("user")).WillOnce(Return(false));
+  ASSERT_TRUE(recording.insertRole("admin"));
+  ASSERT_FALSE(recording.insertRole("user"));
+  ASSERT_EQ(write_set.size(), 1);
+
+  MockWsvCommand other_wsv;
+  EXPECT_CALL(other_wsv, insertRole("admin")).WillOnce(Return(true));
+  ASSERT_TRUE(replay(write_set, other_wsv));
+}
+
+/**
+ * @given write set of two changes
+ * @when the first change fails on replay
+ * @then replay fails and the second change is not executed
+ */
+TEST(WriteSetTest, ReplayStopsOnFailure) {
+  model::Peer peer;
+  peer.address = "127.0.0.1:50051";
+  WriteSet write_set = {
+      [](WsvCommand &command) { return command.insertRole("admin"); },
+      [peer](WsvCommand &command) { return command.insertPeer(peer); }};
+
+  MockWsvCommand wsv;
+  EXPECT_CALL(wsv, insertRole("admin")).WillOnce(Return(false));
+  EXPECT_CALL(wsv, insertPeer(_)).Times(0);
+  ASSERT_FALSE(replay(write_set, wsv));
+}
+
+/**
+ * @given cache of capacity 2
+ * @when three write sets are inserted
+ * @then the oldest one is dropped, and extracted one is removed
+ */
+TEST(WriteSetTest, CacheDropsOldest) {
+  WriteSetCache cache(2);
+  hash256_t first, second, third;
+  first.fill(1);
+  second.fill(2);
+  third.fill(3);
+
+  cache.insert(first, WriteSet(1));
+  cache.insert(second, WriteSet(2));
+  cache.insert(third, WriteSet(3));
+
+  ASSERT_FALSE(cache.extract(first));
+  auto write_set = cache.extract(third);
+  ASSERT_TRUE(write_set);
+  ASSERT_EQ(write_set->size(), 3);
+  ASSERT_FALSE(cache.extract(third));
+  ASSERT_TRUE(cache.extract(second));
+}
@@ -36,8 +36,8 @@ namespace iroha {
           peer = mk_peer("0.0.0.0:50051");
           network = std::make_shared<NetworkImpl>();
 
-          message.hash.proposal_hash = "proposal";
-          message.hash.block_hash = "block";
+          message.hash.proposal_hash = mk_hash("proposal");
+          message.hash.block_hash = mk_hash("block");
 
           network->subscribe(notifications);
 
@@ -53,7 +53,8 @@ namespace iroha {
         }
 
         void TearDown() override {
-          server->Shutdown();
+          // cancel consensus streams instead of waiting for them
+          server->Shutdown(std::chrono::system_clock::now());
         }
 
         std::shared_ptr<MockYacNetworkNotifications> notifications;
@@ -82,6 +83,71 @@ namespace iroha {
         std::unique_lock<std::mutex> lock(mtx);
         cv.wait_for(lock, std::chrono::milliseconds(100));
       }
+
+      /**
+       * @given initialized network
+       * @when send several messages to itself
+       * @then messages are handled in order of sending
+       */
+      TEST_F(YacNetworkTest, MessagesHandledInOrderOverStream) {
+        constexpr size_t kVotes = 10;
+        ::testing::InSequence seq;
+        EXPECT_CALL(*notifications, on_vote(message)).Times(kVotes);
+        EXPECT_CALL(*notifications, on_commit(CommitMessage({message})))
+            .Times(1);
+        EXPECT_CALL(*notifications, on_reject(RejectMessage({message})))
+            .WillOnce(
+                InvokeWithoutArgs(&cv, &std::condition_variable::notify_one));
+
+        for (size_t i = 0; i < kVotes; ++i) {
+          network->send_vote(peer, message);
+        }
+        network->send_commit(peer, CommitMessage({message}));
+        network->send_reject(peer, RejectMessage({message}));
+
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait_for(lock, std::chrono::milliseconds(500));
+      }
+
+      /**
+       * @given peer which is down
+       * @when several messages are sent to it and it is started later
+       * @then stream is reopened after delays instead of dropping all
+       * messages at once, and some of them are handled
+       */
+      TEST_F(YacNetworkTest, StreamReopenedAfterDelay) {
+        constexpr size_t kVotes = 16;
+        auto late_peer = mk_peer("0.0.0.0:50052");
+        auto late_notifications =
+            std::make_shared<MockYacNetworkNotifications>();
+        auto late_network = std::make_shared<NetworkImpl>();
+        late_network->subscribe(late_notifications);
+
+        std::atomic<size_t> handled{0};
+        EXPECT_CALL(*late_notifications, on_vote(message))
+            .WillRepeatedly(InvokeWithoutArgs([&] {
+              ++handled;
+              cv.notify_one();
+            }));
+
+        for (size_t i = 0; i < kVotes; ++i) {
+          network->send_vote(late_peer, message);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort(late_peer.address,
+                                 grpc::InsecureServerCredentials());
+        builder.RegisterService(late_network.get());
+        auto late_server = builder.BuildAndStart();
+        ASSERT_TRUE(late_server);
+
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait_for(
+            lock, std::chrono::seconds(10), [&] { return handled > 0; });
+        ASSERT_GT(handled, 0);
+        late_server->Shutdown(std::chrono::system_clock::now());
+      }
     } // namespace yac
   } // namespace consensus
 } // namespace iroha
@@ -15,7 +15,9 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -82,3 +84,58 @@ TEST_F(YacPeerOrdererTest, PeerOrdererOrderingWhenInvokeFaillCase) {
   auto order = orderer.getOrdering(YacHash());
   ASSERT_EQ(order, nonstd::nullopt);
 }
+
+/**
+ * @given ledger peers
+ * @when ordering is requested twice for the same hash
+ * @then orderings are equal and contain every peer once
+ */
+TEST_F(YacPeerOrdererTest, OrderingIsDeterministicPermutation) {
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillRepeatedly(Return(peers));
+  auto order =
+      orderer.getOrdering(YacHash(mk_hash("proposal"), mk_hash("block")))
+          .value();
+  auto other =
+      orderer.getOrdering(YacHash(mk_hash("proposal"), mk_hash("other")))
+          .value();
+  ASSERT_EQ(order.getPeers(), other.getPeers());
+
+  auto sorted = order.getPeers();
+  std::sort(sorted.begin(), sorted.end(), [](auto &lhs, auto &rhs) {
+    return lhs.address < rhs.address;
+  });
+  ASSERT_EQ(peers, sorted);
+}
+
+/**
+ * @given 10 ledger peers
+ * @when orderings for 10000 rounds with different proposal hashes are taken
+ * @then each peer leads roughly the same number of rounds
+ * and is placed at every position roughly equally often
+ */
+TEST_F(YacPeerOrdererTest, LeadersAreEvenlyDistributed) {
+  std::vector<iroha::model::Peer> cluster;
+  for (size_t i = 0; i < 10; ++i) {
+    cluster.push_back(mk_peer(std::to_string(i)));
+  }
+  EXPECT_CALL(*wsv, getLedgerPeers()).WillRepeatedly(Return(cluster));
+
+  const size_t rounds = 10000;
+  std::map<std::string, size_t> leads;
+  std::map<std::string, size_t> last;
+  for (size_t round = 0; round < rounds; ++round) {
+    auto order = orderer
+                     .getOrdering(YacHash(mk_hash(std::to_string(round)),
+                                          mk_hash("block")))
+                     .value();
+    ++leads[order.currentLeader().address];
+    ++last[order.getPeers().back().address];
+  }
+
+  auto expected = rounds / cluster.size();
+  ASSERT_EQ(cluster.size(), leads.size());
+  for (const auto &peer : cluster) {
+    EXPECT_NEAR(expected, leads[peer.address], expected / 5);
+    EXPECT_NEAR(expected, last[peer.address], expected / 5);
+  }
+}
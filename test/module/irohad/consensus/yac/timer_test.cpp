@@ -24,7 +24,8 @@ using namespace iroha::consensus::yac;
 class TimerTest : public ::testing::Test {
  protected:
   void SetUp() override {
-    timer = std::make_shared<TimerImpl>();
+    timer = std::make_shared<TimerImpl>(
+        std::make_shared<iroha::TimerWheel>());
   }
 
   void TearDown() override {
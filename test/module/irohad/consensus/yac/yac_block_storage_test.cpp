@@ -29,11 +29,12 @@ class YacBlockStorageTest : public ::testing::Test {
  public:
   YacHash hash;
   uint64_t number_of_peers;
-  YacBlockStorage storage = YacBlockStorage(YacHash("proposal", "commit"), 4);
+  YacBlockStorage storage =
+      YacBlockStorage(YacHash(mk_hash("proposal"), mk_hash("commit")), 4);
   std::vector<VoteMessage> valid_votes;
 
   void SetUp() override {
-    hash = YacHash("proposal", "commit");
+    hash = YacHash(mk_hash("proposal"), mk_hash("commit"));
     number_of_peers = 4;
     storage = YacBlockStorage(hash, number_of_peers);
     valid_votes = {
@@ -0,0 +1,171 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include "consensus/yac/transport/yac_pb_converters.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha;
+using namespace iroha::consensus::yac;
+
+static logger::Logger log_ = logger::testLog("YacCertificate");
+
+class YacCertificateTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    for (size_t i = 0; i < 50; ++i) {
+      model::Peer peer;
+      peer.address = std::to_string(i);
+      peer.pubkey.fill(i + 1);
+      order.push_back(peer);
+    }
+    YacHash::HashType proposal, block;
+    proposal.fill('p');
+    block.fill('b');
+    hash = YacHash(proposal, block);
+    hash.block_signature.pubkey.fill('k');
+    hash.block_signature.signature.fill('s');
+  }
+
+  VoteMessage makeVote(const YacHash &hash, const pubkey_t &pubkey) {
+    VoteMessage vote;
+    vote.hash = hash;
+    vote.signature.pubkey = pubkey;
+    vote.signature.signature.fill(pubkey[0] + 100);
+    return vote;
+  }
+
+  std::vector<VoteMessage> makeVotes(size_t number) {
+    std::vector<VoteMessage> votes;
+    for (size_t i = 0; i < number; ++i) {
+      // signers out of ordering order
+      votes.push_back(makeVote(hash, order.at((i * 7) % order.size()).pubkey));
+    }
+    return votes;
+  }
+
+  static void sortVotes(std::vector<VoteMessage> &votes) {
+    std::sort(votes.begin(), votes.end(), [](auto &lhs, auto &rhs) {
+      return lhs.signature.pubkey < rhs.signature.pubkey;
+    });
+  }
+
+  std::vector<model::Peer> order;
+  YacHash hash;
+};
+
+/**
+ * @given commit with votes of 2/3 of 50 peers
+ * @when it is packed as certificate and as full votes
+ * @then both restore the same votes,
+ * certificate takes less than a quarter of bytes
+ */
+TEST_F(YacCertificateTest, CertificateIsSmallerThanFullVotes) {
+  auto votes = makeVotes(34);
+
+  proto::Commit full;
+  PbConverters::serializeBundle(votes, {}, full);
+  proto::Commit compact;
+  PbConverters::serializeBundle(votes, order, compact);
+  ASSERT_EQ(34, full.votes_size());
+  ASSERT_EQ(0, compact.votes_size());
+  ASSERT_EQ(1, compact.certificates_size());
+
+  auto measure = [this](const proto::Commit &commit) {
+    const auto iterations = 1000;
+    auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i) {
+      proto::Commit parsed;
+      parsed.ParseFromString(commit.SerializeAsString());
+      PbConverters::deserializeBundle(parsed, order);
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start)
+               .count()
+        / iterations;
+  };
+  log_->info("Full commit: {} bytes, {} us per round trip",
+             full.ByteSize(),
+             measure(full));
+  log_->info("Compact commit: {} bytes, {} us per round trip",
+             compact.ByteSize(),
+             measure(compact));
+  ASSERT_LT(compact.ByteSize() * 3, full.ByteSize());
+
+  auto restored_full = PbConverters::deserializeBundle(full, order);
+  auto restored_compact = PbConverters::deserializeBundle(compact, order);
+  ASSERT_TRUE(restored_full);
+  ASSERT_TRUE(restored_compact);
+  sortVotes(votes);
+  sortVotes(*restored_full);
+  sortVotes(*restored_compact);
+  ASSERT_EQ(votes, *restored_full);
+  ASSERT_EQ(votes, *restored_compact);
+  ASSERT_TRUE(std::all_of(
+      restored_compact->begin(), restored_compact->end(), [this](auto &vote) {
+        return vote.hash.block_signature == hash.block_signature;
+      }));
+}
+
+/**
+ * @given reject with votes for two blocks and vote of unknown peer
+ * @when it is packed over ordering
+ * @then votes are grouped in two certificates, unknown vote is kept in full
+ */
+TEST_F(YacCertificateTest, RejectWithUnknownSigner) {
+  YacHash::HashType other_block;
+  other_block.fill('o');
+  auto other = YacHash(hash.proposal_hash, other_block);
+  std::vector<VoteMessage> votes = {makeVote(hash, order.at(3).pubkey),
+                                    makeVote(other, order.at(10).pubkey),
+                                    makeVote(hash, order.at(49).pubkey)};
+  pubkey_t unknown;
+  unknown.fill(200);
+  votes.push_back(makeVote(other, unknown));
+
+  proto::Reject reject;
+  PbConverters::serializeBundle(votes, order, reject);
+  ASSERT_EQ(1, reject.votes_size());
+  ASSERT_EQ(2, reject.certificates_size());
+
+  auto restored = PbConverters::deserializeBundle(reject, order);
+  ASSERT_TRUE(restored);
+  sortVotes(votes);
+  sortVotes(*restored);
+  ASSERT_EQ(votes, *restored);
+}
+
+/**
+ * @given certificate packed over ordering
+ * @when it is unpacked over shorter ordering or signatures are missing
+ * @then it is reported as malformed
+ */
+TEST_F(YacCertificateTest, MalformedCertificate) {
+  proto::Commit commit;
+  PbConverters::serializeBundle(
+      std::vector<VoteMessage>{makeVote(hash, order.at(45).pubkey)},
+      order,
+      commit);
+
+  std::vector<model::Peer> shorter(order.begin(), order.begin() + 40);
+  ASSERT_FALSE(PbConverters::deserializeBundle(commit, shorter));
+
+  commit.mutable_certificates(0)->clear_signatures();
+  ASSERT_FALSE(PbConverters::deserializeBundle(commit, order));
+}
@@ -68,28 +68,30 @@ TEST(YacCommonTest, RejectProofNegativeCase) {
 TEST(YacCommonTest, SameProposalTest) {
   log_->info("-----------| Verify ok and fail cases |-----------");
 
-  YacHash hash("proposal", "commit");
+  YacHash hash(mk_hash("proposal"), mk_hash("commit"));
   std::vector<VoteMessage> votes{create_vote(hash, "two"),
                                  create_vote(hash, "three"),
                                  create_vote(hash, "four")};
 
   ASSERT_TRUE(sameProposals(votes));
 
-  votes.push_back(create_vote(YacHash("not-proposal", "commit"), "five"));
+  votes.push_back(create_vote(
+      YacHash(mk_hash("not-proposal"), mk_hash("commit")), "five"));
   ASSERT_FALSE(sameProposals(votes));
 }
 
 TEST(YacCommonTest, getProposalHashTest) {
   log_->info("-----------| Verify ok and fail cases |-----------");
 
-  YacHash hash("proposal", "commit");
+  YacHash hash(mk_hash("proposal"), mk_hash("commit"));
   std::vector<VoteMessage> votes{create_vote(hash, "two"),
                                  create_vote(hash, "three"),
                                  create_vote(hash, "four")};
 
   ASSERT_EQ(hash.proposal_hash, getProposalHash(votes).value());
 
-  votes.push_back(create_vote(YacHash("not-proposal", "commit"), "five"));
+  votes.push_back(create_vote(
+      YacHash(mk_hash("not-proposal"), mk_hash("commit")), "five"));
   ASSERT_EQ(nonstd::nullopt, getProposalHash(votes));
 }
 
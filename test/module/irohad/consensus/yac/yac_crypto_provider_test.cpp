@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 
 #include "crypto/crypto.hpp"
+#include "crypto/hash.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -37,7 +38,7 @@ namespace iroha {
       };
 
       TEST_F(YacCryptoProviderTest, ValidWhenSameMessage) {
-        YacHash hash("1", "1");
+        YacHash hash(sha3_256("1"), sha3_256("1"));
         hash.block_signature.pubkey.fill('0');
         hash.block_signature.signature.fill('1');
 
@@ -47,17 +48,56 @@ namespace iroha {
       }
 
       TEST_F(YacCryptoProviderTest, InvalidWhenMessageChanged) {
-        YacHash hash("1", "1");
+        YacHash hash(sha3_256("1"), sha3_256("1"));
         hash.block_signature.pubkey.fill('0');
         hash.block_signature.signature.fill('1');
 
         auto vote = crypto_provider->getVote(hash);
 
-        vote.hash.block_hash = "hash changed";
+        vote.hash.block_hash = sha3_256("hash changed");
 
         ASSERT_FALSE(crypto_provider->verify(vote));
       }
 
+      /**
+       * @given commit with votes of many peers for the same hash
+       * @when one of signatures is broken
+       * @then commit is valid before and invalid after that
+       */
+      TEST_F(YacCryptoProviderTest, CommitWithManyVotes) {
+        YacHash hash(sha3_256("proposal"), sha3_256("block"));
+        CommitMessage commit;
+        for (auto i = 0; i < 50; ++i) {
+          commit.votes.push_back(
+              CryptoProviderImpl(create_keypair()).getVote(hash));
+        }
+
+        ASSERT_TRUE(crypto_provider->verify(commit));
+
+        commit.votes.at(37).signature.signature.at(0) ^= 1;
+        ASSERT_FALSE(crypto_provider->verify(commit));
+      }
+
+      /**
+       * @given reject with votes for different block hashes
+       * @when it is verified
+       * @then every vote is checked against its own hash
+       */
+      TEST_F(YacCryptoProviderTest, RejectWithDifferentHashes) {
+        RejectMessage reject;
+        for (auto i = 0; i < 10; ++i) {
+          YacHash hash(sha3_256("proposal"),
+                       sha3_256(std::to_string(i % 3)));
+          reject.votes.push_back(
+              CryptoProviderImpl(create_keypair()).getVote(hash));
+        }
+
+        ASSERT_TRUE(crypto_provider->verify(reject));
+
+        std::swap(reject.votes.at(0).hash, reject.votes.at(1).hash);
+        ASSERT_FALSE(crypto_provider->verify(reject));
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
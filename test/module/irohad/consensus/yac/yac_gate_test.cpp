@@ -40,7 +40,7 @@ using ::testing::AtLeast;
 class YacGateTest : public ::testing::Test {
  public:
   void SetUp() override {
-    expected_hash = YacHash("proposal", "block");
+    expected_hash = YacHash(mk_hash("proposal"), mk_hash("block"));
     expected_block.sigs.emplace_back();
     expected_block.sigs.back().pubkey.fill(1);
     expected_hash.block_signature = expected_block.sigs.front();
@@ -148,7 +148,7 @@ TEST_F(YacGateTest, LoadBlockWhenDifferentCommit) {
   EXPECT_CALL(*hash_gate, vote(expected_hash, _)).Times(1);
 
   // expected values
-  expected_hash = YacHash("actual_proposal", "actual_block");
+  expected_hash = YacHash(mk_hash("actual_proposal"), mk_hash("actual_block"));
 
   message.hash = expected_hash;
 
@@ -26,14 +26,41 @@ TEST(YacHashProviderTest, MakeYacHashTest) {
   YacHashProviderImpl hash_provider;
   iroha::model::Block block;
   block.sigs.emplace_back();
-  std::string test_hash = std::string(block.hash.size(), 'f');
-  std::copy(test_hash.begin(), test_hash.end(), block.hash.begin());
-  auto hex_test_hash = block.hash.to_hexstring();
+  block.hash.fill('f');
 
   auto yac_hash = hash_provider.makeHash(block);
 
-  ASSERT_EQ(hex_test_hash, yac_hash.proposal_hash);
-  ASSERT_EQ(hex_test_hash, yac_hash.block_hash);
+  ASSERT_EQ(block.hash, yac_hash.block_hash);
+  ASSERT_NE(yac_hash.block_hash, yac_hash.proposal_hash);
+}
+
+/**
+ * @given blocks of the same and of different rounds
+ * @when hashes are made from them
+ * @then blocks of a round share proposal hash and differ in block hash
+ */
+TEST(YacHashProviderTest, ProposalHashIdentifiesRound) {
+  YacHashProviderImpl hash_provider;
+  iroha::model::Block block;
+  block.sigs.emplace_back();
+  block.height = 5;
+  block.prev_hash.fill('p');
+  block.hash.fill('a');
+
+  auto other_block = block;
+  other_block.txs_number = 1;
+  other_block.hash.fill('b');
+
+  auto next_block = block;
+  next_block.height = 6;
+
+  auto hash = hash_provider.makeHash(block);
+  auto other = hash_provider.makeHash(other_block);
+  auto next = hash_provider.makeHash(next_block);
+
+  ASSERT_EQ(hash.proposal_hash, other.proposal_hash);
+  ASSERT_NE(hash.block_hash, other.block_hash);
+  ASSERT_NE(hash.proposal_hash, next.proposal_hash);
 }
 
 TEST(YacHashProviderTest, ToModelHashTest) {
@@ -36,6 +36,17 @@ namespace iroha {
         return peer;
       }
 
+      /**
+       * @return hash with bytes of label, padded with zeros
+       */
+      YacHash::HashType mk_hash(const std::string &label) {
+        YacHash::HashType hash;
+        std::copy_n(label.begin(),
+                    std::min(label.size(), hash.size()),
+                    hash.begin());
+        return hash;
+      }
+
       VoteMessage create_vote(YacHash hash, std::string pub_key) {
         VoteMessage vote;
         vote.hash = hash;
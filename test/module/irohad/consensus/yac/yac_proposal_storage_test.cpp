@@ -29,11 +29,11 @@ class YacProposalStorageTest : public ::testing::Test {
  public:
   YacHash hash;
   uint64_t number_of_peers;
-  YacProposalStorage storage = YacProposalStorage("proposal", 4);
+  YacProposalStorage storage = YacProposalStorage(mk_hash("proposal"), 4);
   std::vector<VoteMessage> valid_votes;
 
   void SetUp() override {
-    hash = YacHash("proposal", "commit");
+    hash = YacHash(mk_hash("proposal"), mk_hash("commit"));
     number_of_peers = 7;
     storage = YacProposalStorage(hash.proposal_hash, number_of_peers);
     valid_votes = [this]() {
@@ -86,7 +86,7 @@ TEST_F(YacProposalStorageTest, YacProposalStorageWhenRejectCase) {
   }
 
   // insert 2 for other hash
-  auto other_hash = YacHash(hash.proposal_hash, "other_commit");
+  auto other_hash = YacHash(hash.proposal_hash, mk_hash("other_commit"));
   for (auto i = 0; i < 2; ++i) {
     auto answer
         = storage.insert(create_vote(other_hash,
@@ -103,3 +103,19 @@ TEST_F(YacProposalStorageTest, YacProposalStorageWhenRejectCase) {
   ASSERT_NE(nonstd::nullopt, answer);
   ASSERT_EQ(6, answer->reject->votes.size());
 }
+
+TEST_F(YacProposalStorageTest, YacProposalStorageWhenPeerVotesTwice) {
+  log_->info("Init storage => insert votes of the same peer "
+                 "for different blocks => expected one vote counted");
+
+  auto other_hash = YacHash(hash.proposal_hash, mk_hash("other_commit"));
+  for (auto i = 0; i < 4; ++i) {
+    ASSERT_EQ(nonstd::nullopt, storage.insert(valid_votes.at(i)));
+    ASSERT_EQ(nonstd::nullopt,
+              storage.insert(create_vote(other_hash, std::to_string(i))));
+  }
+
+  auto commit = storage.insert(valid_votes.at(4));
+  ASSERT_NE(nonstd::nullopt, commit);
+  ASSERT_EQ(5, commit->commit->votes.size());
+}
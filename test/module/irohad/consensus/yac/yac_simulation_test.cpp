@@ -0,0 +1,180 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "consensus/yac/yac.hpp"
+#include "crypto/hash.hpp"
+#include "framework/network_simulator.hpp"
+
+using namespace iroha::consensus::yac;
+using namespace framework::simulator;
+
+namespace {
+  /**
+   * Crypto of simulated peer, votes carry public key of the peer
+   * and all messages are valid
+   */
+  class SimulatedCryptoProvider : public YacCryptoProvider {
+   public:
+    explicit SimulatedCryptoProvider(iroha::pubkey_t pubkey)
+        : pubkey_(pubkey) {}
+
+    bool verify(CommitMessage msg) override { return true; }
+    bool verify(RejectMessage msg) override { return true; }
+    bool verify(VoteMessage msg) override { return true; }
+
+    VoteMessage getVote(YacHash hash) override {
+      VoteMessage vote;
+      vote.hash = hash;
+      vote.signature.pubkey = pubkey_;
+      return vote;
+    }
+
+   private:
+    iroha::pubkey_t pubkey_;
+  };
+
+  /**
+   * Cluster of YAC peers over simulated network
+   */
+  class SimulatedCluster {
+   public:
+    SimulatedCluster(size_t size, LinkConfig link, uint64_t seed)
+        : network(clock, link, seed), commits(size) {
+      for (size_t i = 0; i < size; ++i) {
+        iroha::model::Peer peer;
+        peer.address = "peer" + std::to_string(i);
+        peer.pubkey[0] = i % 256;
+        peer.pubkey[1] = i / 256;
+        peers.push_back(peer);
+      }
+      for (size_t i = 0; i < size; ++i) {
+        auto transport =
+            std::make_shared<SimulatedYacNetwork>(network, peers[i].address);
+        auto yac = Yac::create(
+            YacVoteStorage(),
+            transport,
+            std::make_shared<SimulatedCryptoProvider>(peers[i].pubkey),
+            std::make_shared<VirtualTimer>(clock),
+            ClusterOrdering(peers),
+            VOTE_DELAY);
+        transport->subscribe(yac);
+        yac->on_commit().subscribe([this, i](auto commit) {
+          commits[i] = clock.now();
+        });
+        yacs.push_back(yac);
+        transports.push_back(transport);
+      }
+    }
+
+    /**
+     * All peers vote for the same hash at current time
+     */
+    void vote() {
+      for (auto &yac : yacs) {
+        yac->vote(YacHash(iroha::sha3_256("proposal"),
+                          iroha::sha3_256("block")),
+                  ClusterOrdering(peers));
+      }
+    }
+
+    size_t committed() const {
+      return std::count_if(commits.begin(),
+                           commits.end(),
+                           [](const auto &time) { return bool(time); });
+    }
+
+    /**
+     * @return time of the last commit since start of the round
+     */
+    uint64_t roundLatency() const {
+      uint64_t latency = 0;
+      for (const auto &time : commits) {
+        latency = std::max(latency, *time);
+      }
+      return latency;
+    }
+
+    static constexpr uint64_t VOTE_DELAY = 100;
+
+    VirtualClock clock;
+    NetworkSimulator network;
+    std::vector<iroha::model::Peer> peers;
+    std::vector<std::shared_ptr<SimulatedYacNetwork>> transports;
+    std::vector<std::shared_ptr<Yac>> yacs;
+    std::vector<nonstd::optional<uint64_t>> commits;
+  };
+
+  constexpr uint64_t SimulatedCluster::VOTE_DELAY;
+  constexpr size_t kPeers = 100;
+}  // namespace
+
+/**
+ * @given cluster of 100 peers with latency of 10-15 ms
+ * @when all peers vote for the same hash
+ * @then every peer commits after the first leader collects votes
+ */
+TEST(YacSimulationTest, HundredPeersCommitInOneRound) {
+  SimulatedCluster cluster(kPeers, LinkConfig{10, 5, 0.}, 1);
+  cluster.vote();
+  cluster.clock.runUntilIdle();
+
+  ASSERT_EQ(kPeers, cluster.committed());
+  // vote to the leader and commit from it
+  ASSERT_LE(cluster.roundLatency(), 30);
+}
+
+/**
+ * @given two clusters with the same seed and jittery links
+ * @when round is run in both
+ * @then every peer commits at the same virtual time in both clusters
+ */
+TEST(YacSimulationTest, RoundIsReproducible) {
+  SimulatedCluster first(kPeers, LinkConfig{5, 50, 0.}, 7);
+  SimulatedCluster second(kPeers, LinkConfig{5, 50, 0.}, 7);
+  first.vote();
+  second.vote();
+  first.clock.runUntilIdle();
+  second.clock.runUntilIdle();
+
+  ASSERT_EQ(kPeers, first.committed());
+  ASSERT_EQ(first.commits, second.commits);
+}
+
+/**
+ * @given cluster partitioned into groups without supermajority
+ * @when peers vote and partition is healed later
+ * @then nobody commits before heal and every peer commits after it
+ */
+TEST(YacSimulationTest, CommitAfterPartitionIsHealed) {
+  SimulatedCluster cluster(kPeers, LinkConfig{10, 0, 0.}, 3);
+  std::vector<std::vector<std::string>> groups(2);
+  for (size_t i = 0; i < kPeers; ++i) {
+    groups[i < 60 ? 0 : 1].push_back(cluster.peers[i].address);
+  }
+  cluster.network.partition(groups);
+
+  cluster.vote();
+  cluster.clock.runUntil(3 * SimulatedCluster::VOTE_DELAY);
+  ASSERT_EQ(0, cluster.committed());
+
+  cluster.network.heal();
+  cluster.clock.runUntilIdle();
+  ASSERT_EQ(kPeers, cluster.committed());
+  ASSERT_GT(cluster.roundLatency(), 3 * SimulatedCluster::VOTE_DELAY);
+}
@@ -65,7 +65,7 @@ TEST_F(YacTest, ValidCaseWhenReceiveSupermajority) {
   EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
   EXPECT_CALL(*crypto, verify(An<VoteMessage>())).WillRepeatedly(Return(true));
 
-  YacHash my_hash("proposal_hash", "block_hash");
+  YacHash my_hash(mk_hash("proposal_hash"), mk_hash("block_hash"));
   yac->vote(my_hash, my_order);
 
   for (auto i = 0; i < 3; ++i) {
@@ -93,7 +93,7 @@ TEST_F(YacTest, ValidCaseWhenReceiveCommit) {
                     my_order,
                     delay);
 
-  YacHash my_hash("proposal_hash", "block_hash");
+  YacHash my_hash(mk_hash("proposal_hash"), mk_hash("block_hash"));
   auto wrapper = make_test_subscriber<CallExact>(yac->on_commit(), 1);
   wrapper.subscribe([my_hash](auto val) {
     ASSERT_EQ(my_hash, val.votes.at(0).hash);
@@ -144,7 +144,7 @@ TEST_F(YacTest, ValidCaseWhenReceiveCommitTwice) {
                     my_order,
                     delay);
 
-  YacHash my_hash("proposal_hash", "block_hash");
+  YacHash my_hash(mk_hash("proposal_hash"), mk_hash("block_hash"));
   auto wrapper = make_test_subscriber<CallExact>(yac->on_commit(), 1);
   wrapper.subscribe([my_hash](auto val) {
     ASSERT_EQ(my_hash, val.votes.at(0).hash);
@@ -210,7 +210,7 @@ TEST_F(YacTest, ValidCaseWhenSoloConsensus) {
       .Times(1)
       .WillRepeatedly(Return(true));
 
-  YacHash my_hash("proposal_hash", "block_hash");
+  YacHash my_hash(mk_hash("proposal_hash"), mk_hash("block_hash"));
 
   auto wrapper = make_test_subscriber<CallExact>(yac->on_commit(), 1);
   wrapper.subscribe([my_hash](auto val) {
@@ -260,7 +260,7 @@ TEST_F(YacTest, ValidCaseWhenVoteAfterCommit) {
   EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
   EXPECT_CALL(*crypto, verify(An<VoteMessage>())).Times(0);
 
-  YacHash my_hash("proposal_hash", "block_hash");
+  YacHash my_hash(mk_hash("proposal_hash"), mk_hash("block_hash"));
 
   std::vector<VoteMessage> votes;
 
@@ -271,3 +271,95 @@ TEST_F(YacTest, ValidCaseWhenVoteAfterCommit) {
 
   yac->vote(my_hash, my_order);
 }
+
+/**
+ * @given 7 peers with distinct keys and tree dissemination with fanout 2,
+ * this peer is the second one in ordering
+ * @when supermajority of votes is collected by this peer
+ * and later commit is received from the parent peer
+ * @then this peer sends commit to the first two peers only
+ * and relays received commit to its children, the fifth and sixth peers
+ */
+TEST_F(YacTest, TreeDissemination) {
+  auto my_peers = default_peers;
+  for (size_t i = 0; i < my_peers.size(); ++i) {
+    // mocked crypto provider votes with zero key
+    my_peers[i].pubkey.fill(i == 1 ? 0 : i + 1);
+  }
+  ClusterOrdering my_order(my_peers);
+
+  Dissemination dissemination;
+  dissemination.fanout = 2;
+  yac = Yac::create(
+      YacVoteStorage(), network, crypto, timer, my_order, delay, dissemination);
+
+  EXPECT_CALL(*network, send_commit(my_peers[0], _)).Times(1);
+  EXPECT_CALL(*network, send_commit(my_peers[1], _)).Times(1);
+  EXPECT_CALL(*network, send_commit(my_peers[4], _)).Times(1);
+  EXPECT_CALL(*network, send_commit(my_peers[5], _)).Times(1);
+  EXPECT_CALL(*network, send_reject(_, _)).Times(0);
+
+  EXPECT_CALL(*crypto, verify(An<CommitMessage>()))
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*crypto, verify(An<VoteMessage>())).WillRepeatedly(Return(true));
+
+  YacHash my_hash(mk_hash("proposal_hash"), mk_hash("block_hash"));
+  auto wrapper = make_test_subscriber<CallExact>(yac->on_commit(), 1);
+  wrapper.subscribe();
+
+  yac->vote(my_hash, my_order);
+
+  std::vector<VoteMessage> votes;
+  for (auto i = 0; i < 5; ++i) {
+    votes.push_back(create_vote(my_hash, std::to_string(i)));
+    yac->on_vote(votes.back());
+  }
+
+  yac->on_commit(CommitMessage(votes));
+  // duplicate is neither relayed nor notified
+  yac->on_commit(CommitMessage(votes));
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given 7 peers with distinct keys and tree dissemination with fanout 2,
+ * this peer voted in a round with one proposal
+ * @when commit of another proposal is received
+ * @then commit is notified but not relayed, since tree positions of the
+ * stored ordering do not belong to the round of the commit
+ */
+TEST_F(YacTest, CommitOfOtherRoundNotRelayed) {
+  auto my_peers = default_peers;
+  for (size_t i = 0; i < my_peers.size(); ++i) {
+    // mocked crypto provider votes with zero key
+    my_peers[i].pubkey.fill(i == 1 ? 0 : i + 1);
+  }
+  ClusterOrdering my_order(my_peers);
+
+  Dissemination dissemination;
+  dissemination.fanout = 2;
+  yac = Yac::create(
+      YacVoteStorage(), network, crypto, timer, my_order, delay, dissemination);
+
+  EXPECT_CALL(*network, send_commit(_, _)).Times(0);
+  EXPECT_CALL(*network, send_reject(_, _)).Times(0);
+
+  EXPECT_CALL(*crypto, verify(An<CommitMessage>()))
+      .WillRepeatedly(Return(true));
+
+  YacHash my_hash(mk_hash("proposal_hash"), mk_hash("block_hash"));
+  YacHash other_hash(mk_hash("other_proposal"), mk_hash("other_block"));
+  auto wrapper = make_test_subscriber<CallExact>(yac->on_commit(), 1);
+  wrapper.subscribe();
+
+  yac->vote(my_hash, my_order);
+
+  std::vector<VoteMessage> votes;
+  for (auto i = 0; i < 5; ++i) {
+    votes.push_back(create_vote(other_hash, std::to_string(i)));
+  }
+  yac->on_commit(CommitMessage(votes));
+
+  ASSERT_TRUE(wrapper.validate());
+}
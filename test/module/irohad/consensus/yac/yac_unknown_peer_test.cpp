@@ -48,7 +48,7 @@ TEST_F(YacTest, UnknownVoteBeforeCommit) {
       .WillRepeatedly(Return(true));
 
   VoteMessage vote;
-  vote.hash = YacHash("my_proposal", "my_block");
+  vote.hash = YacHash(mk_hash("my_proposal"), mk_hash("my_block"));
   std::string unknown = "unknown";
   std::copy(unknown.begin(), unknown.end(), vote.signature.pubkey.begin());
   // assume that our peer receive message
@@ -86,7 +86,7 @@ TEST_F(YacTest, UnknownVoteAfterCommit) {
   EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
   EXPECT_CALL(*crypto, verify(An<VoteMessage>())).WillOnce(Return(true));
 
-  YacHash my_hash("proposal_hash", "block_hash");
+  YacHash my_hash(mk_hash("proposal_hash"), mk_hash("block_hash"));
 
   std::vector<VoteMessage> votes;
 
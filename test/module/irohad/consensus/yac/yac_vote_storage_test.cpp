@@ -0,0 +1,148 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "consensus/yac/storage/yac_vote_storage.hpp"
+#include "module/irohad/consensus/yac/yac_mocks.hpp"
+
+using namespace iroha::consensus::yac;
+
+class YacVoteStorageTest : public ::testing::Test {
+ public:
+  uint64_t number_of_peers = 4;
+  size_t window = 3;
+  YacVoteStorage storage = YacVoteStorage(window);
+
+  /**
+   * Insert votes of all peers for the round
+   */
+  void commitRound(const std::string &proposal) {
+    for (auto i = 0u; i < number_of_peers; ++i) {
+      storage.store(
+          create_vote(YacHash(mk_hash(proposal), mk_hash("block")),
+                      std::to_string(i)),
+          number_of_peers);
+    }
+  }
+
+  /**
+   * Insert single vote for the round
+   */
+  void openRound(const std::string &proposal) {
+    storage.store(
+        create_vote(YacHash(mk_hash(proposal), mk_hash("block")), "0"),
+        number_of_peers);
+  }
+};
+
+/**
+ * @given vote storage
+ * @when supermajority of votes for proposal is inserted
+ * @then proposal is committed and processing state is kept per proposal
+ */
+TEST_F(YacVoteStorageTest, CommitAndProcessingState) {
+  commitRound("first");
+  openRound("second");
+
+  ASSERT_TRUE(storage.isHashCommitted(mk_hash("first")));
+  ASSERT_FALSE(storage.isHashCommitted(mk_hash("second")));
+
+  storage.markAsProcessedState(mk_hash("first"));
+  ASSERT_TRUE(storage.getProcessingState(mk_hash("first")));
+  ASSERT_FALSE(storage.getProcessingState(mk_hash("second")));
+}
+
+/**
+ * @given vote storage with window of 3 rounds
+ * @when many rounds are committed
+ * @then only the last window of rounds is kept
+ */
+TEST_F(YacVoteStorageTest, CommittedRoundsAreEvicted) {
+  for (auto i = 0; i < 20; ++i) {
+    commitRound(std::to_string(i));
+    ASSERT_LE(storage.getNumberOfRounds(), window);
+  }
+
+  ASSERT_FALSE(storage.isHashCommitted(mk_hash("0")));
+  ASSERT_TRUE(storage.isHashCommitted(mk_hash("19")));
+}
+
+/**
+ * @given vote storage with window of 3 rounds
+ * @when rounds are never decided
+ * @then they are kept for two windows at most
+ */
+TEST_F(YacVoteStorageTest, UndecidedRoundsAreBounded) {
+  for (auto i = 0; i < 20; ++i) {
+    openRound(std::to_string(i));
+    ASSERT_LE(storage.getNumberOfRounds(), 2 * window);
+  }
+  ASSERT_EQ(2 * window, storage.getNumberOfRounds());
+
+  // decided round releases older undecided ones
+  commitRound("last");
+  openRound("next");
+  ASSERT_LE(storage.getNumberOfRounds(), window);
+  ASSERT_TRUE(storage.isHashCommitted(mk_hash("last")));
+}
+
+/**
+ * @given vote storage with window of 3 rounds and processed round
+ * @when the round is evicted and its late commit arrives
+ * @then commit is ignored and the round stays processed
+ */
+TEST_F(YacVoteStorageTest, LateCommitOfEvictedRoundIgnored) {
+  std::vector<VoteMessage> votes;
+  for (auto i = 0u; i < number_of_peers; ++i) {
+    votes.push_back(create_vote(YacHash(mk_hash("0"), mk_hash("block")),
+                                std::to_string(i)));
+  }
+  ASSERT_NE(nonstd::nullopt,
+            storage.store(CommitMessage(votes), number_of_peers));
+  storage.markAsProcessedState(mk_hash("0"));
+
+  for (auto i = 1; i < 5; ++i) {
+    commitRound(std::to_string(i));
+  }
+  ASSERT_FALSE(storage.isHashCommitted(mk_hash("0")));
+
+  ASSERT_EQ(nonstd::nullopt,
+            storage.store(CommitMessage(votes), number_of_peers));
+  ASSERT_EQ(nonstd::nullopt, storage.store(votes.at(0), number_of_peers));
+  ASSERT_TRUE(storage.getProcessingState(mk_hash("0")));
+  ASSERT_LE(storage.getNumberOfRounds(), window);
+}
+
+/**
+ * @given vote storage
+ * @when commit message is inserted after the same votes
+ * @then duplicated votes are not counted twice
+ */
+TEST_F(YacVoteStorageTest, CommitAfterVotes) {
+  std::vector<VoteMessage> votes;
+  for (auto i = 0u; i < number_of_peers; ++i) {
+    votes.push_back(create_vote(YacHash(mk_hash("proposal"), mk_hash("block")),
+                                std::to_string(i)));
+  }
+  for (auto i = 0u; i < 3; ++i) {
+    storage.store(votes.at(i), number_of_peers);
+  }
+
+  auto answer = storage.store(CommitMessage(votes), number_of_peers);
+  ASSERT_NE(nonstd::nullopt, answer);
+  ASSERT_EQ(number_of_peers, answer->commit->votes.size());
+}
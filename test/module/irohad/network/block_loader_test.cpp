@@ -93,7 +93,8 @@ TEST_F(BlockLoaderTest, ValidWhenOneBlock) {
   Block top_block;
   block.height = block.height + 1;
 
-  EXPECT_CALL(*provider, verify(A<const Block &>())).WillOnce(Return(true));
+  // signatures are verified by chain validator
+  EXPECT_CALL(*provider, verify(A<const Block &>())).Times(0);
   EXPECT_CALL(*peer_query, getLedgerPeers()).WillOnce(Return(peers));
   EXPECT_CALL(*storage, getTopBlocks(1))
       .WillOnce(Return(rxcpp::observable<>::just(block)));
@@ -122,9 +123,7 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
     blocks.push_back(block);
   }
 
-  EXPECT_CALL(*provider, verify(A<const Block &>()))
-      .Times(num_blocks)
-      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*provider, verify(A<const Block &>())).Times(0);
   EXPECT_CALL(*peer_query, getLedgerPeers()).WillOnce(Return(peers));
   EXPECT_CALL(*storage, getTopBlocks(1))
       .WillOnce(Return(rxcpp::observable<>::just(block)));
@@ -51,6 +51,10 @@ namespace iroha {
                    void(std::shared_ptr<const model::Transaction> transaction));
 
       MOCK_METHOD0(on_proposal, rxcpp::observable<model::Proposal>());
+
+      MOCK_CONST_METHOD0(queueDepth, size_t());
+
+      MOCK_CONST_METHOD0(overloaded, bool());
     };
 
     class MockConsensusGate : public ConsensusGate {
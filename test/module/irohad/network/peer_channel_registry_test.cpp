@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "network/impl/peer_channel_registry.hpp"
+#include "ordering.grpc.pb.h"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::network;
+
+class PeerChannelRegistryTest : public ::testing::Test {
+ public:
+  PeerChannelRegistry<iroha::ordering::proto::OrderingGateTransportGrpc>
+      registry;
+};
+
+/**
+ * @given registry with stubs for two peers
+ * @when stubs are requested for the same peers again
+ * @then the same stubs are returned and no channel is opened
+ */
+TEST_F(PeerChannelRegistryTest, StubsReusedForSamePeers) {
+  std::vector<std::string> peers{"0.0.0.0:10001", "0.0.0.0:10002"};
+
+  auto first = registry.stubs(peers);
+  auto second = registry.stubs(peers);
+
+  ASSERT_EQ(2, first.size());
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(2, registry.size());
+}
+
+/**
+ * @given registry with stubs for two peers
+ * @when one peer is replaced by another
+ * @then stub of the remaining peer is kept, the removed peer is dropped
+ */
+TEST_F(PeerChannelRegistryTest, RefreshedWhenPeersChange) {
+  auto first = registry.stubs({"0.0.0.0:10001", "0.0.0.0:10002"});
+
+  auto second = registry.stubs({"0.0.0.0:10002", "0.0.0.0:10003"});
+
+  ASSERT_EQ(2, second.size());
+  ASSERT_EQ(first.at(1), second.at(0));
+  ASSERT_NE(first.at(0), second.at(1));
+  ASSERT_EQ(2, registry.size());
+}
+
+/**
+ * @given peers list with repeated address
+ * @when stubs are requested
+ * @then one stub per distinct address is returned
+ */
+TEST_F(PeerChannelRegistryTest, DuplicatePeersCollapsed) {
+  auto stubs = registry.stubs({"0.0.0.0:10001", "0.0.0.0:10001"});
+
+  ASSERT_EQ(1, stubs.size());
+  ASSERT_EQ(1, registry.size());
+}
@@ -0,0 +1,56 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ordering/impl/delay_histogram.hpp"
+
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+/**
+ * @given empty histogram
+ * @when delays are recorded
+ * @then they are counted in power of two millisecond buckets
+ */
+TEST(DelayHistogramTest, Buckets) {
+  DelayHistogram histogram;
+  histogram.record(500us);
+  histogram.record(1ms);
+  histogram.record(3ms);
+  histogram.record(3ms);
+  histogram.record(1h);
+
+  auto snapshot = histogram.snapshot();
+  ASSERT_EQ(5, snapshot.count);
+  ASSERT_EQ(1, snapshot.counts[0]);
+  ASSERT_EQ(1, snapshot.counts[1]);
+  ASSERT_EQ(2, snapshot.counts[2]);
+  ASSERT_EQ(1, snapshot.counts[DelayHistogram::BUCKETS - 1]);
+  ASSERT_EQ(4ms, snapshot.percentile(0.8));
+  ASSERT_EQ(DelayHistogram::upperBound(DelayHistogram::BUCKETS - 1),
+            snapshot.percentile(1));
+}
+
+/**
+ * @given empty histogram
+ * @when percentile is requested
+ * @then it is zero
+ */
+TEST(DelayHistogramTest, EmptyPercentile) {
+  ASSERT_EQ(0ms, DelayHistogram().snapshot().percentile(0.99));
+}
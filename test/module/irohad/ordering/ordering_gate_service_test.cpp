@@ -98,6 +98,8 @@ class OrderingGateServiceTest : public ::testing::Test {
   std::string address{"0.0.0.0:50051"};
   std::shared_ptr<OrderingGateImpl> gate;
   std::shared_ptr<OrderingServiceImpl> service;
+  std::shared_ptr<iroha::TimerWheel> timer_wheel =
+      std::make_shared<iroha::TimerWheel>();
 
   std::vector<Proposal> proposals;
   std::atomic<size_t> counter;
@@ -121,7 +123,7 @@ TEST_F(OrderingGateServiceTest, SplittingBunchTransactions) {
   const size_t commit_delay = 400;
 
   service = std::make_shared<OrderingServiceImpl>(
-      wsv, max_proposal, commit_delay, service_transport);
+      wsv, max_proposal, commit_delay, service_transport, timer_wheel);
   service_transport->subscribe(service);
 
   start();
@@ -163,7 +165,7 @@ TEST_F(OrderingGateServiceTest, ProposalsReceivedWhenProposalSize) {
   const size_t commit_delay = 1000;
 
   service = std::make_shared<OrderingServiceImpl>(
-      wsv, max_proposal, commit_delay, service_transport);
+      wsv, max_proposal, commit_delay, service_transport, timer_wheel);
   service_transport->subscribe(service);
 
   start();
@@ -189,3 +191,92 @@ TEST_F(OrderingGateServiceTest, ProposalsReceivedWhenProposalSize) {
     }
   }
 }
+
+/**
+ * @given ordering service which sends compact proposals
+ * @when transactions are propagated through the gate
+ * @then gate receives proposals with full transactions
+ */
+TEST_F(OrderingGateServiceTest, CompactProposalsReceived) {
+  service_transport = std::make_shared<OrderingServiceTransportGrpc>(true);
+
+  std::shared_ptr<MockPeerQuery> wsv = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<Peer>{peer}));
+  const size_t max_proposal = 5;
+  const size_t commit_delay = 1000;
+
+  service = std::make_shared<OrderingServiceImpl>(
+      wsv, max_proposal, commit_delay, service_transport, timer_wheel);
+  service_transport->subscribe(service);
+
+  start();
+  std::unique_lock<std::mutex> lk(m);
+  auto wrapper = init(2);
+
+  for (size_t i = 0; i < 10; ++i) {
+    send_transaction(i);
+  }
+
+  cv.wait_for(lk, 10s, [this]() { return counter == 0; });
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(proposals.size(), 2);
+
+  size_t i = 0;
+  for (auto &&proposal : proposals) {
+    ASSERT_EQ(proposal.transactions.size(), 5);
+    for (auto &&tx : proposal.transactions) {
+      ASSERT_EQ(tx.tx_counter, i++);
+    }
+  }
+}
+
+/**
+ * @given ordering service with queue high-water mark 2
+ * @when gate sends transactions over the mark
+ * @then service rejects the batch and gate is overloaded, and after the
+ * queue is drained by a proposal gate resends the rejected batch, is not
+ * overloaded and its transactions are accepted again
+ */
+TEST_F(OrderingGateServiceTest, GateAcceptedAgainWhenQueueDrains) {
+  std::shared_ptr<MockPeerQuery> wsv = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<Peer>{peer}));
+  const size_t max_proposal = 100;
+  const size_t commit_delay = 500;
+  const size_t max_queue = 2;
+
+  service = std::make_shared<OrderingServiceImpl>(wsv,
+                                                  max_proposal,
+                                                  commit_delay,
+                                                  service_transport,
+                                                  timer_wheel,
+                                                  max_queue);
+  service_transport->subscribe(service);
+
+  start();
+  std::unique_lock<std::mutex> lk(m);
+  auto wrapper = init(2);
+
+  send_transaction(0);
+  send_transaction(1);
+  send_transaction(2);
+  ASSERT_TRUE(gate->overloaded());
+  ASSERT_EQ(max_queue, service->queueDepth());
+
+  cv.wait_for(lk, 10s, [this] { return counter == 0; });
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(max_queue, proposals.at(0).transactions.size());
+  ASSERT_EQ(1, proposals.at(1).transactions.size());
+  ASSERT_EQ(2, proposals.at(1).transactions.at(0).tx_counter);
+  ASSERT_EQ(0, service->queueDepth());
+
+  for (auto i = 0; i < 100 and gate->overloaded(); ++i) {
+    std::this_thread::sleep_for(10ms);
+  }
+  ASSERT_FALSE(gate->overloaded());
+  send_transaction(3);
+  ASSERT_EQ(1, service->queueDepth());
+  ASSERT_FALSE(gate->overloaded());
+}
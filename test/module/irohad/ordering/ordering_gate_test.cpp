@@ -27,6 +27,9 @@
 #include "ordering/impl/ordering_service_impl.hpp"
 #include "ordering/impl/ordering_service_transport_grpc.hpp"
 
+#include "crypto/hash.hpp"
+#include "model/converters/pb_transaction_factory.hpp"
+
 using namespace iroha::ordering;
 using namespace iroha::model;
 using namespace iroha::network;
@@ -34,7 +37,8 @@ using namespace framework::test_subscriber;
 using namespace std::chrono_literals;
 
 using ::testing::_;
-using ::testing::InvokeWithoutArgs;
+using ::testing::Invoke;
+using ::testing::Return;
 
 class MockOrderingGateTransportGrpcService
     : public proto::OrderingServiceTransportGrpc::Service {
@@ -43,6 +47,14 @@ class MockOrderingGateTransportGrpcService
                ::grpc::Status(::grpc::ServerContext *,
                               const iroha::protocol::Transaction *,
                               ::google::protobuf::Empty *));
+  MOCK_METHOD3(onBatch,
+               ::grpc::Status(::grpc::ServerContext *,
+                              const proto::TransactionBatch *,
+                              proto::BatchResponse *));
+  MOCK_METHOD3(getTransactions,
+               ::grpc::Status(::grpc::ServerContext *,
+                              const proto::TransactionsRequest *,
+                              proto::TransactionsResponse *));
 };
 
 class OrderingGateTest : public ::testing::Test {
@@ -96,11 +108,11 @@ class OrderingGateTest : public ::testing::Test {
 TEST_F(OrderingGateTest, TransactionReceivedByServerWhenSent) {
   // Init => send 5 transactions => 5 transactions are processed by server
 
-  size_t call_count = 0;
-  EXPECT_CALL(*fake_service, onTransaction(_, _, _))
-      .Times(5)
-      .WillRepeatedly(InvokeWithoutArgs([&] {
-        ++call_count;
+  std::atomic<size_t> call_count{0};
+  EXPECT_CALL(*fake_service, onTransaction(_, _, _)).Times(0);
+  EXPECT_CALL(*fake_service, onBatch(_, _, _))
+      .WillRepeatedly(Invoke([&](auto, auto batch, auto) {
+        call_count += batch->transactions_size();
         cv.notify_one();
         return grpc::Status::OK;
       }));
@@ -111,6 +123,140 @@ TEST_F(OrderingGateTest, TransactionReceivedByServerWhenSent) {
 
   std::unique_lock<std::mutex> lock(m);
   cv.wait_for(lock, 10s, [&] { return call_count == 5; });
+  ASSERT_EQ(5, call_count);
+}
+
+/**
+ * @given transport with batch size 5 and long batch delay
+ * @when 10 transactions are propagated
+ * @then server receives two batches of 5 transactions without waiting
+ * for the delay
+ */
+TEST_F(OrderingGateTest, BatchSentWhenBatchSizeReached) {
+  auto batched_transport =
+      std::make_shared<OrderingGateTransportGrpc>(address, 5, 1h);
+
+  std::vector<int> batches;
+  EXPECT_CALL(*fake_service, onBatch(_, _, _))
+      .Times(2)
+      .WillRepeatedly(Invoke([&](auto, auto batch, auto) {
+        std::lock_guard<std::mutex> lock(m);
+        batches.push_back(batch->transactions_size());
+        cv.notify_one();
+        return grpc::Status::OK;
+      }));
+
+  for (size_t i = 0; i < 10; ++i) {
+    batched_transport->propagate_transaction(std::make_shared<Transaction>());
+  }
+
+  std::unique_lock<std::mutex> lock(m);
+  cv.wait_for(lock, 10s, [&] { return batches.size() == 2; });
+  ASSERT_EQ(std::vector<int>({5, 5}), batches);
+}
+
+/**
+ * @given transport with large batch size and short batch delay
+ * @when 3 transactions are propagated
+ * @then server receives them in one batch after the delay
+ */
+TEST_F(OrderingGateTest, BatchSentWhenDelayExpired) {
+  auto batched_transport =
+      std::make_shared<OrderingGateTransportGrpc>(address, 100, 50ms);
+
+  std::vector<int> batches;
+  EXPECT_CALL(*fake_service, onBatch(_, _, _))
+      .Times(1)
+      .WillRepeatedly(Invoke([&](auto, auto batch, auto) {
+        std::lock_guard<std::mutex> lock(m);
+        batches.push_back(batch->transactions_size());
+        cv.notify_one();
+        return grpc::Status::OK;
+      }));
+
+  for (size_t i = 0; i < 3; ++i) {
+    batched_transport->propagate_transaction(std::make_shared<Transaction>());
+  }
+
+  std::unique_lock<std::mutex> lock(m);
+  cv.wait_for(lock, 10s, [&] { return batches.size() == 1; });
+  ASSERT_EQ(std::vector<int>({3}), batches);
+}
+
+/**
+ * @given transport with batch size 2 and long batch delay
+ * @when batch is sent and service reports its queue depth
+ * @then transport reports that depth plus transactions not sent yet
+ */
+TEST_F(OrderingGateTest, QueueDepthReportedByService) {
+  auto batched_transport =
+      std::make_shared<OrderingGateTransportGrpc>(address, 2, 1h, 1h);
+
+  // the last transaction is flushed when transport is destroyed
+  EXPECT_CALL(*fake_service, onBatch(_, _, _))
+      .WillRepeatedly(Invoke([](auto, auto, auto response) {
+        response->set_queue_depth(42);
+        return grpc::Status::OK;
+      }));
+
+  ASSERT_EQ(0, batched_transport->queueDepth());
+  for (size_t i = 0; i < 2; ++i) {
+    batched_transport->propagate_transaction(std::make_shared<Transaction>());
+  }
+  for (auto i = 0; i < 100 and batched_transport->queueDepth() != 42; ++i) {
+    std::this_thread::sleep_for(10ms);
+  }
+  ASSERT_EQ(42, batched_transport->queueDepth());
+
+  batched_transport->propagate_transaction(std::make_shared<Transaction>());
+  ASSERT_EQ(43, batched_transport->queueDepth());
+  ASSERT_FALSE(batched_transport->overloaded());
+}
+
+/**
+ * @given transport with batch size 1 and short backoff
+ * @when service rejects a batch because its queue is full
+ * @then transport is overloaded until the backoff expires, the rejected
+ * batch is resent after that, and transport is not overloaded after the
+ * next batch is accepted
+ */
+TEST_F(OrderingGateTest, OverloadedUntilBackoffExpires) {
+  auto batched_transport =
+      std::make_shared<OrderingGateTransportGrpc>(address, 1, 1h, 100ms);
+
+  std::atomic<size_t> accepted{0};
+  EXPECT_CALL(*fake_service, onBatch(_, _, _))
+      .WillOnce(Invoke([](auto, auto, auto) {
+        return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "full");
+      }))
+      .WillRepeatedly(Invoke([&](auto, auto, auto response) {
+        response->set_queue_depth(1);
+        ++accepted;
+        return grpc::Status::OK;
+      }));
+
+  batched_transport->propagate_transaction(std::make_shared<Transaction>());
+  for (auto i = 0; i < 100 and not batched_transport->overloaded(); ++i) {
+    std::this_thread::sleep_for(1ms);
+  }
+  ASSERT_TRUE(batched_transport->overloaded());
+  ASSERT_EQ(0, batched_transport->queueDepth());
+
+  for (auto i = 0; i < 100 and batched_transport->overloaded(); ++i) {
+    std::this_thread::sleep_for(10ms);
+  }
+  for (auto i = 0; i < 100 and accepted == 0; ++i) {
+    std::this_thread::sleep_for(10ms);
+  }
+  ASSERT_EQ(1, accepted);
+  ASSERT_FALSE(batched_transport->overloaded());
+
+  batched_transport->propagate_transaction(std::make_shared<Transaction>());
+  for (auto i = 0; i < 100 and accepted == 1; ++i) {
+    std::this_thread::sleep_for(10ms);
+  }
+  ASSERT_EQ(2, accepted);
+  ASSERT_FALSE(batched_transport->overloaded());
 }
 
 TEST_F(OrderingGateTest, ProposalReceivedByGateWhenSent) {
@@ -126,3 +272,102 @@ TEST_F(OrderingGateTest, ProposalReceivedByGateWhenSent) {
 
   ASSERT_TRUE(wrapper.validate());
 }
+
+/**
+ * @given transaction propagated through the gate
+ * @when compact proposal with its hash is received
+ * @then proposal is rebuilt from the local pool without fetching
+ */
+TEST_F(OrderingGateTest, CompactProposalRebuiltFromPool) {
+  EXPECT_CALL(*fake_service, getTransactions(_, _, _)).Times(0);
+  std::vector<Proposal> proposals;
+  auto wrapper = make_test_subscriber<CallExact>(gate_impl->on_proposal(), 1);
+  wrapper.subscribe([&](auto proposal) { proposals.push_back(proposal); });
+
+  auto tx = std::make_shared<Transaction>();
+  tx->tx_counter = 42;
+  gate_impl->propagate_transaction(tx);
+
+  grpc::ServerContext context;
+  proto::CompactProposal proposal;
+  proposal.set_height(3);
+  proposal.add_hashes(iroha::hash(*tx).to_string());
+  google::protobuf::Empty response;
+
+  ASSERT_TRUE(transport->onCompactProposal(&context, &proposal, &response)
+                  .ok());
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(3, proposals.at(0).height);
+  ASSERT_EQ(1, proposals.at(0).transactions.size());
+  ASSERT_EQ(42, proposals.at(0).transactions.at(0).tx_counter);
+}
+
+/**
+ * @given two transactions propagated through the gate, the second one is
+ * taken by compact proposal
+ * @when transactions are propagated until pool is full
+ * @then the first transaction is kept in the pool, taken transaction does
+ * not occupy its place
+ */
+TEST_F(OrderingGateTest, TakenTransactionLeavesPool) {
+  EXPECT_CALL(*fake_service, onBatch(_, _, _))
+      .WillRepeatedly(Return(grpc::Status::OK));
+  EXPECT_CALL(*fake_service, getTransactions(_, _, _)).Times(0);
+  auto wrapper = make_test_subscriber<CallExact>(gate_impl->on_proposal(), 2);
+  wrapper.subscribe();
+
+  auto propose = [this](const Transaction &tx) {
+    grpc::ServerContext context;
+    proto::CompactProposal proposal;
+    proposal.add_hashes(iroha::hash(tx).to_string());
+    google::protobuf::Empty response;
+    return transport->onCompactProposal(&context, &proposal, &response);
+  };
+
+  auto oldest = std::make_shared<Transaction>();
+  gate_impl->propagate_transaction(oldest);
+  auto taken = std::make_shared<Transaction>();
+  taken->tx_counter = 1;
+  gate_impl->propagate_transaction(taken);
+  ASSERT_TRUE(propose(*taken).ok());
+
+  for (size_t i = 2; i <= OrderingGateTransportGrpc::POOL_CAPACITY; ++i) {
+    auto tx = std::make_shared<Transaction>();
+    tx->tx_counter = i;
+    gate_impl->propagate_transaction(tx);
+  }
+  ASSERT_TRUE(propose(*oldest).ok());
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given empty transaction pool
+ * @when compact proposal is received
+ * @then missing transactions are fetched from ordering service
+ */
+TEST_F(OrderingGateTest, CompactProposalFetchesMissing) {
+  Transaction tx;
+  tx.tx_counter = 7;
+  EXPECT_CALL(*fake_service, getTransactions(_, _, _))
+      .WillOnce(Invoke([&tx](auto, auto request, auto response) {
+        EXPECT_EQ(1, request->hashes_size());
+        *response->add_transactions() =
+            iroha::model::converters::PbTransactionFactory().serialize(tx);
+        return grpc::Status::OK;
+      }));
+  std::vector<Proposal> proposals;
+  auto wrapper = make_test_subscriber<CallExact>(gate_impl->on_proposal(), 1);
+  wrapper.subscribe([&](auto proposal) { proposals.push_back(proposal); });
+
+  grpc::ServerContext context;
+  proto::CompactProposal proposal;
+  proposal.add_hashes(iroha::hash(tx).to_string());
+  google::protobuf::Empty response;
+
+  ASSERT_TRUE(transport->onCompactProposal(&context, &proposal, &response)
+                  .ok());
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(7, proposals.at(0).transactions.at(0).tx_counter);
+}
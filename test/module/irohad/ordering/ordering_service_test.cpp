@@ -15,6 +15,10 @@
  * limitations under the License.
  */
 
+#include <set>
+#include <thread>
+
+#include <boost/filesystem.hpp>
 #include <grpc++/grpc++.h>
 
 #include "logger/logger.hpp"
@@ -28,6 +32,8 @@
 #include "ordering/impl/ordering_service_impl.hpp"
 #include "ordering/impl/ordering_service_transport_grpc.hpp"
 
+#include "crypto/hash.hpp"
+
 using namespace iroha;
 using namespace iroha::ordering;
 using namespace iroha::model;
@@ -77,7 +83,18 @@ class OrderingServiceTest : public ::testing::Test {
   std::mutex m;
   std::string address{"0.0.0.0:50051"};
   model::Peer peer;
+  /**
+   * @return transaction with unique hash
+   */
+  model::Transaction makeTransaction() {
+    model::Transaction tx;
+    tx.tx_counter = tx_counter++;
+    return tx;
+  }
+
   std::shared_ptr<MockPeerQuery> wsv;
+  uint64_t tx_counter = 0;
+  std::shared_ptr<TimerWheel> timer_wheel = std::make_shared<TimerWheel>();
 };
 
 TEST_F(OrderingServiceTest, SimpleTest) {
@@ -88,7 +105,7 @@ TEST_F(OrderingServiceTest, SimpleTest) {
   const size_t commit_delay = 1000;
 
   auto ordering_service = std::make_shared<OrderingServiceImpl>(
-      wsv, max_proposal, commit_delay, fake_transport);
+      wsv, max_proposal, commit_delay, fake_transport, timer_wheel);
   fake_transport->subscribe(ordering_service);
 
   EXPECT_CALL(*fake_transport, publishProposal(_, _)).Times(1);
@@ -101,7 +118,7 @@ TEST_F(OrderingServiceTest, ValidWhenProposalSizeStrategy) {
   const size_t commit_delay = 1000;
 
   auto ordering_service = std::make_shared<OrderingServiceImpl>(
-      wsv, max_proposal, commit_delay, fake_transport);
+      wsv, max_proposal, commit_delay, fake_transport, timer_wheel);
   fake_transport->subscribe(ordering_service);
 
   // Init => proposal size 5 => 2 proposals after 10 transactions
@@ -117,7 +134,7 @@ TEST_F(OrderingServiceTest, ValidWhenProposalSizeStrategy) {
       .WillRepeatedly(Return(std::vector<Peer>{peer}));
 
   for (size_t i = 0; i < 10; ++i) {
-    ordering_service->onTransaction(model::Transaction());
+    ordering_service->onTransaction(makeTransaction());
   }
 
   std::unique_lock<std::mutex> lock(m);
@@ -134,7 +151,7 @@ TEST_F(OrderingServiceTest, ValidWhenTimerStrategy) {
   const size_t commit_delay = 400;
 
   auto ordering_service = std::make_shared<OrderingServiceImpl>(
-      wsv, max_proposal, commit_delay, fake_transport);
+      wsv, max_proposal, commit_delay, fake_transport, timer_wheel);
   fake_transport->subscribe(ordering_service);
 
   EXPECT_CALL(*fake_transport, publishProposal(_, _))
@@ -145,13 +162,256 @@ TEST_F(OrderingServiceTest, ValidWhenTimerStrategy) {
       }));
 
   for (size_t i = 0; i < 8; ++i) {
-    ordering_service->onTransaction(model::Transaction());
+    ordering_service->onTransaction(makeTransaction());
   }
 
   std::unique_lock<std::mutex> lk(m);
   cv.wait_for(lk, 10s);
 
-  ordering_service->onTransaction(model::Transaction());
-  ordering_service->onTransaction(model::Transaction());
+  ordering_service->onTransaction(makeTransaction());
+  ordering_service->onTransaction(makeTransaction());
   cv.wait_for(lk, 10s);
 }
+
+/**
+ * @given ordering service
+ * @when the same transaction is received several times
+ * @then it is proposed once and duplicates are counted
+ */
+TEST_F(OrderingServiceTest, DuplicateTransactionsDropped) {
+  const size_t max_proposal = 3;
+  const size_t commit_delay = 1000;
+
+  auto ordering_service = std::make_shared<OrderingServiceImpl>(
+      wsv, max_proposal, commit_delay, fake_transport, timer_wheel);
+  fake_transport->subscribe(ordering_service);
+
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<Peer>{peer}));
+
+  std::vector<model::Proposal> proposals;
+  EXPECT_CALL(*fake_transport, publishProposal(_, _))
+      .Times(1)
+      .WillOnce(Invoke([&](const auto &proposal, const auto &) {
+        std::lock_guard<std::mutex> lock(m);
+        proposals.push_back(proposal);
+        cv.notify_one();
+      }));
+
+  auto tx = makeTransaction();
+  ordering_service->onTransaction(tx);
+  ordering_service->onTransaction(tx);
+  ordering_service->onTransaction(makeTransaction());
+  ordering_service->onTransaction(tx);
+  ordering_service->onTransaction(makeTransaction());
+
+  std::unique_lock<std::mutex> lock(m);
+  cv.wait_for(lock, 10s, [&] { return not proposals.empty(); });
+  ASSERT_EQ(1, proposals.size());
+  ASSERT_EQ(3, proposals.front().transactions.size());
+  ASSERT_EQ(2, ordering_service->droppedDuplicates());
+}
+
+/**
+ * @given ordering service with queue high-water mark 3
+ * @when 5 transactions are received before any proposal
+ * @then 3 of them are queued and the rest are dropped as overflow
+ */
+TEST_F(OrderingServiceTest, QueueBoundedByHighWaterMark) {
+  const size_t max_proposal = 100;
+  const size_t commit_delay = 10000;
+  const size_t max_queue = 3;
+
+  auto ordering_service = std::make_shared<OrderingServiceImpl>(
+      wsv, max_proposal, commit_delay, fake_transport, timer_wheel, max_queue);
+  fake_transport->subscribe(ordering_service);
+
+  EXPECT_CALL(*fake_transport, publishProposal(_, _)).Times(0);
+
+  for (size_t i = 0; i < 5; ++i) {
+    ordering_service->onTransaction(makeTransaction());
+  }
+
+  ASSERT_EQ(3, ordering_service->queueDepth());
+  ASSERT_EQ(2, ordering_service->droppedOverflow());
+  ASSERT_EQ(0, ordering_service->droppedDuplicates());
+}
+
+/**
+ * @given ordering service which proposed two transactions
+ * @when block with only the first one is committed
+ * @then the second one is accepted again, and the first one is dropped
+ */
+TEST_F(OrderingServiceTest, UncommittedTransactionAcceptedAgain) {
+  const size_t max_proposal = 2;
+  const size_t commit_delay = 1000;
+
+  auto ordering_service = std::make_shared<OrderingServiceImpl>(
+      wsv, max_proposal, commit_delay, fake_transport, timer_wheel);
+  fake_transport->subscribe(ordering_service);
+
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<Peer>{peer}));
+
+  std::vector<model::Proposal> proposals;
+  EXPECT_CALL(*fake_transport, publishProposal(_, _))
+      .WillRepeatedly(Invoke([&](const auto &proposal, const auto &) {
+        std::lock_guard<std::mutex> lock(m);
+        proposals.push_back(proposal);
+        cv.notify_one();
+      }));
+
+  auto committed = makeTransaction();
+  auto rejected = makeTransaction();
+  ordering_service->onTransaction(committed);
+  ordering_service->onTransaction(rejected);
+  {
+    std::unique_lock<std::mutex> lock(m);
+    ASSERT_TRUE(
+        cv.wait_for(lock, 10s, [&] { return not proposals.empty(); }));
+  }
+
+  model::Block block;
+  block.height = proposals.front().height;
+  block.transactions = {committed};
+  ordering_service->onCommit(block);
+
+  ordering_service->onTransaction(committed);
+  ordering_service->onTransaction(rejected);
+  ASSERT_EQ(1, ordering_service->droppedDuplicates());
+}
+
+/**
+ * @given ordering service
+ * @when transactions are received concurrently from several threads
+ * @then every transaction is proposed once, proposal heights are consecutive
+ * and proposals are not generated on receiving threads
+ */
+TEST_F(OrderingServiceTest, ConcurrentTransactionsProposedOnce) {
+  const size_t max_proposal = 10;
+  const size_t commit_delay = 100;
+  const size_t threads_number = 4;
+  const size_t txs_per_thread = 50;
+
+  auto ordering_service = std::make_shared<OrderingServiceImpl>(
+      wsv, max_proposal, commit_delay, fake_transport, timer_wheel);
+  fake_transport->subscribe(ordering_service);
+
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<Peer>{peer}));
+
+  std::vector<model::Proposal> proposals;
+  std::vector<std::thread::id> publishers;
+  size_t proposed = 0;
+  EXPECT_CALL(*fake_transport, publishProposal(_, _))
+      .WillRepeatedly(Invoke([&](const auto &proposal, const auto &) {
+        std::lock_guard<std::mutex> lock(m);
+        proposals.push_back(proposal);
+        publishers.push_back(std::this_thread::get_id());
+        proposed += proposal.transactions.size();
+        cv.notify_one();
+      }));
+
+  std::vector<std::vector<model::Transaction>> txs(threads_number);
+  for (auto &thread_txs : txs) {
+    for (size_t i = 0; i < txs_per_thread; ++i) {
+      thread_txs.push_back(makeTransaction());
+    }
+  }
+  std::vector<std::thread> senders;
+  std::vector<std::thread::id> sender_ids;
+  for (const auto &thread_txs : txs) {
+    senders.emplace_back([&ordering_service, &thread_txs] {
+      for (const auto &tx : thread_txs) {
+        ordering_service->onTransaction(tx);
+      }
+    });
+    sender_ids.push_back(senders.back().get_id());
+  }
+  for (auto &sender : senders) {
+    sender.join();
+  }
+
+  std::unique_lock<std::mutex> lock(m);
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [&] {
+    return proposed == threads_number * txs_per_thread;
+  }));
+
+  std::set<uint64_t> counters;
+  for (size_t i = 0; i < proposals.size(); ++i) {
+    ASSERT_EQ(2 + i, proposals[i].height);
+    for (const auto &tx : proposals[i].transactions) {
+      ASSERT_TRUE(counters.insert(tx.tx_counter).second);
+    }
+  }
+  for (const auto &id : publishers) {
+    ASSERT_EQ(sender_ids.end(),
+              std::find(sender_ids.begin(), sender_ids.end(), id));
+  }
+}
+
+/**
+ * @given write-ahead log with two transactions, one of which is committed
+ * to the ledger
+ * @when ordering service is created with the log
+ * @then only the uncommitted transaction is proposed, the committed one is
+ * removed from the log and dropped as a duplicate
+ */
+TEST_F(OrderingServiceTest, CommittedRecoveredTransactionNotQueued) {
+  const std::string wal_path = "/tmp/ordering_service_wal";
+  boost::filesystem::remove_all(wal_path);
+  auto committed = makeTransaction();
+  auto pending = makeTransaction();
+  {
+    auto wal = OrderingWal::create(wal_path);
+    wal->append(iroha::hash(committed), committed);
+    wal->append(iroha::hash(pending), pending);
+  }
+
+  auto block_query = std::make_shared<MockBlockQuery>();
+  EXPECT_CALL(*block_query, getTxByHashSync(_))
+      .WillRepeatedly(Return(boost::none));
+  EXPECT_CALL(*block_query,
+              getTxByHashSync(iroha::hash(committed).to_string()))
+      .WillOnce(Return(committed));
+
+  const size_t max_proposal = 10;
+  const size_t commit_delay = 10000;
+  const size_t max_queue = 100;
+
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<Peer>{peer}));
+  std::vector<model::Proposal> proposals;
+  EXPECT_CALL(*fake_transport, publishProposal(_, _))
+      .WillRepeatedly(Invoke([&](const auto &proposal, const auto &) {
+        std::lock_guard<std::mutex> lock(m);
+        proposals.push_back(proposal);
+      }));
+
+  std::shared_ptr<OrderingWal> wal = OrderingWal::create(wal_path);
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            max_proposal,
+                                            commit_delay,
+                                            fake_transport,
+                                            timer_wheel,
+                                            max_queue,
+                                            1,
+                                            std::vector<LaneConfig>{},
+                                            wal,
+                                            block_query);
+
+  {
+    std::lock_guard<std::mutex> lock(m);
+    ASSERT_EQ(1, proposals.size());
+    ASSERT_EQ(std::vector<model::Transaction>{pending},
+              proposals.front().transactions);
+  }
+  ASSERT_EQ(1, wal->size());
+  ordering_service->onTransaction(committed);
+  ASSERT_EQ(1, ordering_service->droppedDuplicates());
+
+  ordering_service.reset();
+  wal.reset();
+  boost::filesystem::remove_all(wal_path);
+}
@@ -0,0 +1,179 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+#include "crypto/hash.hpp"
+#include "ordering/impl/ordering_wal.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+class OrderingWalTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    boost::filesystem::remove_all(path);
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove_all(path);
+  }
+
+  model::Transaction makeTransaction(uint64_t counter) {
+    model::Transaction tx;
+    tx.creator_account_id = "admin@test";
+    tx.tx_counter = counter;
+    tx.created_ts = counter;
+    return tx;
+  }
+
+  size_t countSegments() {
+    return std::distance(boost::filesystem::directory_iterator(path),
+                         boost::filesystem::directory_iterator());
+  }
+
+  std::string path = "/tmp/ordering_wal";
+};
+
+/**
+ * @given log with appended transactions
+ * @when log is reopened
+ * @then transactions are recovered in order of appending
+ */
+TEST_F(OrderingWalTest, RecoversInOrder) {
+  {
+    auto wal = OrderingWal::create(path);
+    ASSERT_TRUE(wal);
+    EXPECT_TRUE(wal->recovered().empty());
+    for (uint64_t i = 0; i < 5; ++i) {
+      auto tx = makeTransaction(i);
+      wal->append(iroha::hash(tx), tx);
+    }
+  }
+
+  auto wal = OrderingWal::create(path);
+  ASSERT_TRUE(wal);
+  auto txs = wal->recovered();
+  ASSERT_EQ(5, txs.size());
+  for (uint64_t i = 0; i < 5; ++i) {
+    EXPECT_EQ(i, txs[i].tx_counter);
+  }
+  EXPECT_EQ(5, wal->size());
+  EXPECT_TRUE(wal->recovered().empty());
+}
+
+/**
+ * @given log with appended transactions, some of them removed
+ * @when log is reopened
+ * @then only not removed transactions are recovered
+ */
+TEST_F(OrderingWalTest, RemovedAreNotRecovered) {
+  {
+    auto wal = OrderingWal::create(path);
+    ASSERT_TRUE(wal);
+    std::vector<hash256_t> removed;
+    for (uint64_t i = 0; i < 6; ++i) {
+      auto tx = makeTransaction(i);
+      wal->append(iroha::hash(tx), tx);
+      if (i % 2 == 0) {
+        removed.push_back(iroha::hash(tx));
+      }
+    }
+    wal->remove(removed);
+    EXPECT_EQ(3, wal->size());
+  }
+
+  auto wal = OrderingWal::create(path);
+  ASSERT_TRUE(wal);
+  auto txs = wal->recovered();
+  ASSERT_EQ(3, txs.size());
+  EXPECT_EQ(1, txs[0].tx_counter);
+  EXPECT_EQ(3, txs[1].tx_counter);
+  EXPECT_EQ(5, txs[2].tx_counter);
+}
+
+/**
+ * @given log with live transactions written by previous runs
+ * @when log is reopened several times
+ * @then live transactions are compacted into a single segment file
+ */
+TEST_F(OrderingWalTest, ReplayCompactsSegments) {
+  for (uint64_t run = 0; run < 3; ++run) {
+    auto wal = OrderingWal::create(path);
+    ASSERT_TRUE(wal);
+    EXPECT_EQ(run, wal->recovered().size());
+    auto tx = makeTransaction(run);
+    wal->append(iroha::hash(tx), tx);
+    wal->sync();
+    EXPECT_EQ(1, countSegments());
+  }
+}
+
+/**
+ * @given log with a partially written record at the end
+ * @when log is reopened
+ * @then records before the torn one are recovered
+ */
+TEST_F(OrderingWalTest, TornTailIsIgnored) {
+  {
+    auto wal = OrderingWal::create(path);
+    ASSERT_TRUE(wal);
+    for (uint64_t i = 0; i < 2; ++i) {
+      auto tx = makeTransaction(i);
+      wal->append(iroha::hash(tx), tx);
+    }
+  }
+  auto segment = boost::filesystem::directory_iterator(path)->path();
+  {
+    std::ofstream output(segment.string(),
+                         std::ios::binary | std::ios::app);
+    output << "\x40\x00\x00\x00garbage";
+  }
+
+  auto wal = OrderingWal::create(path);
+  ASSERT_TRUE(wal);
+  EXPECT_EQ(2, wal->recovered().size());
+}
+
+/**
+ * @given log with small segments
+ * @when transactions are appended and removed in order
+ * @then drained segments at the front are deleted
+ */
+TEST_F(OrderingWalTest, DrainedSegmentsAreDeleted) {
+  auto wal = OrderingWal::create(path, 1h, 256);
+  ASSERT_TRUE(wal);
+  std::vector<hash256_t> hashes;
+  for (uint64_t i = 0; i < 20; ++i) {
+    auto tx = makeTransaction(i);
+    hashes.push_back(iroha::hash(tx));
+    wal->append(hashes.back(), tx);
+  }
+  wal->sync();
+  auto written = wal->segments();
+  EXPECT_LT(1, written);
+  EXPECT_EQ(written, countSegments());
+
+  wal->remove({hashes.begin(), hashes.begin() + 10});
+  wal->sync();
+  EXPECT_GT(written, wal->segments());
+  EXPECT_EQ(wal->segments(), countSegments());
+  EXPECT_EQ(10, wal->size());
+}
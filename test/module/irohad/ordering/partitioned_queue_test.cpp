@@ -0,0 +1,138 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <thread>
+
+#include "ordering/impl/partitioned_queue.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+
+model::Transaction makeTransaction(const std::string &account,
+                                   uint64_t counter) {
+  model::Transaction tx;
+  tx.creator_account_id = account;
+  tx.tx_counter = counter;
+  return tx;
+}
+
+/**
+ * @given queue with 4 partitions
+ * @when transactions of several accounts are pushed and merged
+ * @then every transaction is taken once and each account keeps its order
+ */
+TEST(PartitionedQueueTest, AccountOrderKept) {
+  PartitionedQueue queue(4);
+  std::vector<std::string> accounts = {"a@test", "b@test", "c@test", "d@test"};
+  for (uint64_t i = 0; i < 100; ++i) {
+    queue.push(makeTransaction(accounts[i % accounts.size()], i));
+  }
+  ASSERT_EQ(100, queue.size());
+
+  std::map<std::string, uint64_t> last;
+  size_t taken = 0;
+  while (queue.size() > 0) {
+    auto txs = queue.pop(7);
+    ASSERT_LE(txs.size(), 7);
+    for (const auto &tx : txs) {
+      auto it = last.find(tx.creator_account_id);
+      if (it != last.end()) {
+        ASSERT_LT(it->second, tx.tx_counter);
+      }
+      last[tx.creator_account_id] = tx.tx_counter;
+    }
+    taken += txs.size();
+  }
+  ASSERT_EQ(100, taken);
+  ASSERT_TRUE(queue.pop(7).empty());
+}
+
+/**
+ * @given two queues
+ * @when the same transactions are pushed to both in the same order
+ * @then merges produce the same proposals
+ */
+TEST(PartitionedQueueTest, MergeDeterministic) {
+  PartitionedQueue first(3), second(3);
+  for (uint64_t i = 0; i < 50; ++i) {
+    auto tx = makeTransaction("account" + std::to_string(i % 5) + "@test", i);
+    first.push(tx);
+    second.push(tx);
+  }
+
+  while (first.size() > 0) {
+    ASSERT_EQ(first.pop(10), second.pop(10));
+  }
+}
+
+/**
+ * @given accounts routed to different partitions
+ * @when one proposal is merged
+ * @then transactions of partitions are interleaved instead of draining
+ * one partition first
+ */
+TEST(PartitionedQueueTest, PartitionsInterleaved) {
+  std::string first = "a@test", second;
+  for (size_t i = 0; second.empty(); ++i) {
+    auto account = "account" + std::to_string(i) + "@test";
+    if (PartitionedQueue::partitionOf(account, 2)
+        != PartitionedQueue::partitionOf(first, 2)) {
+      second = account;
+    }
+  }
+
+  PartitionedQueue queue(2);
+  for (uint64_t i = 0; i < 4; ++i) {
+    queue.push(makeTransaction(first, i));
+  }
+  queue.push(makeTransaction(second, 4));
+
+  auto txs = queue.pop(2);
+  ASSERT_EQ(2, txs.size());
+  ASSERT_NE(txs[0].creator_account_id, txs[1].creator_account_id);
+}
+
+/**
+ * @given queue with 4 partitions
+ * @when accounts push concurrently
+ * @then nothing is lost and each account keeps its order
+ */
+TEST(PartitionedQueueTest, ConcurrentProducers) {
+  PartitionedQueue queue(4);
+  const uint64_t per_account = 1000;
+  std::vector<std::thread> producers;
+  for (size_t p = 0; p < 8; ++p) {
+    producers.emplace_back([&queue, p, per_account] {
+      auto account = "producer" + std::to_string(p) + "@test";
+      for (uint64_t i = 0; i < per_account; ++i) {
+        queue.push(makeTransaction(account, i));
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+
+  auto txs = queue.pop(8 * per_account);
+  ASSERT_EQ(8 * per_account, txs.size());
+  std::map<std::string, uint64_t> next;
+  for (const auto &tx : txs) {
+    ASSERT_EQ(next[tx.creator_account_id]++, tx.tx_counter);
+  }
+}
@@ -0,0 +1,135 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <thread>
+
+#include "ordering/impl/priority_lanes.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+model::Transaction makeTransaction(const std::string &account,
+                                   uint64_t counter) {
+  model::Transaction tx;
+  tx.creator_account_id = account;
+  tx.tx_counter = counter;
+  return tx;
+}
+
+size_t countFrom(const std::vector<model::Transaction> &txs,
+                 const std::string &domain) {
+  return std::count_if(txs.begin(), txs.end(), [&](const auto &tx) {
+    return tx.creator_account_id.find("@" + domain) != std::string::npos;
+  });
+}
+
+std::vector<LaneConfig> makeLanes() {
+  return {{"settlement", 8, {"clearing@bank"}, {"settlement"}}};
+}
+
+/**
+ * @given settlement lane with weight 8 and default lane with weight 1
+ * @when both lanes are full and proposal of 90 transactions is taken
+ * @then lanes share it 80 to 10, settlement transactions first
+ */
+TEST(PriorityLanesTest, WeightedShares) {
+  PriorityLanes lanes(makeLanes(), 2);
+  for (uint64_t i = 0; i < 200; ++i) {
+    lanes.push(makeTransaction("bulk@upload", i));
+    lanes.push(makeTransaction("alice@settlement", i));
+  }
+
+  auto txs = lanes.pop(90);
+  ASSERT_EQ(90, txs.size());
+  ASSERT_EQ(80, countFrom(txs, "settlement"));
+  ASSERT_EQ(10, countFrom(txs, "upload"));
+  ASSERT_EQ("alice@settlement", txs.front().creator_account_id);
+}
+
+/**
+ * @given lanes where only the default lane has transactions
+ * @when proposal is taken
+ * @then the whole proposal is filled from the default lane
+ */
+TEST(PriorityLanesTest, IdleLaneSpaceReused) {
+  PriorityLanes lanes(makeLanes(), 2);
+  for (uint64_t i = 0; i < 100; ++i) {
+    lanes.push(makeTransaction("bulk@upload", i));
+  }
+  lanes.push(makeTransaction("clearing@bank", 0));
+
+  auto txs = lanes.pop(50);
+  ASSERT_EQ(50, txs.size());
+  ASSERT_EQ("clearing@bank", txs.front().creator_account_id);
+  ASSERT_EQ(51, lanes.size());
+}
+
+/**
+ * @given lanes with transactions of several accounts
+ * @when all transactions are taken in several proposals
+ * @then every account keeps its order
+ */
+TEST(PriorityLanesTest, AccountOrderKept) {
+  PriorityLanes lanes(makeLanes(), 4);
+  std::vector<std::string> accounts = {
+      "a@upload", "b@upload", "clearing@bank", "c@settlement"};
+  for (uint64_t i = 0; i < 400; ++i) {
+    lanes.push(makeTransaction(accounts[i % accounts.size()], i));
+  }
+
+  std::map<std::string, uint64_t> last;
+  size_t taken = 0;
+  while (lanes.size() > 0) {
+    auto txs = lanes.pop(33);
+    ASSERT_FALSE(txs.empty());
+    for (const auto &tx : txs) {
+      auto it = last.find(tx.creator_account_id);
+      if (it != last.end()) {
+        ASSERT_LT(it->second, tx.tx_counter);
+      }
+      last[tx.creator_account_id] = tx.tx_counter;
+    }
+    taken += txs.size();
+  }
+  ASSERT_EQ(400, taken);
+}
+
+/**
+ * @given lanes with queued transactions
+ * @when they are taken after waiting in the queue
+ * @then queueing delay is recorded in the histogram of their lane
+ */
+TEST(PriorityLanesTest, DelaysRecordedPerLane) {
+  PriorityLanes lanes(makeLanes(), 1);
+  lanes.push(makeTransaction("bulk@upload", 0));
+  lanes.push(makeTransaction("bulk@upload", 1));
+  std::this_thread::sleep_for(20ms);
+  lanes.pop(10);
+
+  auto stats = lanes.stats();
+  ASSERT_EQ(2, stats.size());
+  ASSERT_EQ("settlement", stats[0].name);
+  ASSERT_EQ(0, stats[0].delays.count);
+  ASSERT_EQ(PriorityLanes::DEFAULT_LANE, stats[1].name);
+  ASSERT_EQ(2, stats[1].delays.count);
+  ASSERT_LE(20ms, stats[1].delays.total / 2);
+  ASSERT_LE(16ms, stats[1].delays.percentile(0.5));
+}
@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ordering/impl/proposal_controller.hpp"
+
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+ProposalController::Bounds makeBounds() {
+  return {10, 100, 50ms, 1000ms};
+}
+
+/**
+ * @given controller without observations
+ * @when decisions are requested
+ * @then proposal size and delay are maximal
+ */
+TEST(ProposalControllerTest, InitiallyMaximal) {
+  ProposalController controller(makeBounds());
+
+  ASSERT_EQ(100, controller.proposalSize());
+  ASSERT_EQ(1000ms, controller.proposalDelay());
+  ASSERT_EQ(0, controller.metrics().adjustments);
+}
+
+/**
+ * @given controller
+ * @when queue depth is observed repeatedly
+ * @then proposal size follows the depth within bounds
+ */
+TEST(ProposalControllerTest, SizeFollowsQueueDepth) {
+  ProposalController controller(makeBounds());
+
+  for (int i = 0; i < 50; ++i) {
+    controller.onQueueDepth(40);
+  }
+  ASSERT_EQ(40, controller.proposalSize());
+
+  for (int i = 0; i < 50; ++i) {
+    controller.onQueueDepth(0);
+  }
+  ASSERT_EQ(10, controller.proposalSize());
+
+  for (int i = 0; i < 50; ++i) {
+    controller.onQueueDepth(1000);
+  }
+  ASSERT_EQ(100, controller.proposalSize());
+  ASSERT_LT(0, controller.metrics().adjustments);
+}
+
+/**
+ * @given controller under high load
+ * @when validation of a transaction takes 20 ms
+ * @then proposal size is limited by what can be validated within max delay
+ */
+TEST(ProposalControllerTest, SizeLimitedByValidationTime) {
+  ProposalController controller(makeBounds());
+  controller.onQueueDepth(1000);
+
+  controller.onValidated(2000ms, 100);
+
+  ASSERT_EQ(50, controller.proposalSize());
+  ASSERT_EQ(20000us, controller.metrics().validation_per_tx);
+}
+
+/**
+ * @given controller
+ * @when commit latency is observed
+ * @then proposal delay follows it within bounds
+ */
+TEST(ProposalControllerTest, DelayFollowsCommitLatency) {
+  ProposalController controller(makeBounds());
+
+  controller.onCommitted(200ms);
+  ASSERT_EQ(200ms, controller.proposalDelay());
+
+  for (int i = 0; i < 50; ++i) {
+    controller.onCommitted(1ms);
+  }
+  ASSERT_EQ(50ms, controller.proposalDelay());
+
+  for (int i = 0; i < 50; ++i) {
+    controller.onCommitted(5000ms);
+  }
+  ASSERT_EQ(1000ms, controller.proposalDelay());
+}
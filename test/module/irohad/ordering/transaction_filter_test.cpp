@@ -0,0 +1,122 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "ordering/impl/transaction_filter.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+hash256_t makeHash(uint8_t seed) {
+  hash256_t hash;
+  hash.fill(seed);
+  return hash;
+}
+
+/**
+ * @given empty filter
+ * @when the same hash is inserted twice
+ * @then the second insertion is rejected and counted as duplicate
+ */
+TEST(TransactionFilterTest, DuplicateRejected) {
+  TransactionFilter filter(1h, 4);
+
+  ASSERT_TRUE(filter.insert(makeHash(1)));
+  ASSERT_TRUE(filter.insert(makeHash(2)));
+  ASSERT_FALSE(filter.insert(makeHash(1)));
+
+  ASSERT_EQ(2, filter.accepted());
+  ASSERT_EQ(1, filter.duplicates());
+}
+
+/**
+ * @given filter with short window
+ * @when committed hash is inserted again after the window passed
+ * @then it is accepted
+ */
+TEST(TransactionFilterTest, CommittedHashForgottenAfterWindow) {
+  TransactionFilter filter(20ms, 2);
+
+  ASSERT_TRUE(filter.insert(makeHash(1)));
+  filter.commit(makeHash(1));
+  ASSERT_FALSE(filter.insert(makeHash(1)));
+  std::this_thread::sleep_for(50ms);
+
+  ASSERT_TRUE(filter.insert(makeHash(1)));
+  ASSERT_EQ(1, filter.duplicates());
+}
+
+/**
+ * @given filter with short window
+ * @when pending hash is inserted again after the window passed
+ * @then it is still rejected
+ */
+TEST(TransactionFilterTest, PendingHashKeptAfterWindow) {
+  TransactionFilter filter(20ms, 2);
+
+  ASSERT_TRUE(filter.insert(makeHash(1)));
+  std::this_thread::sleep_for(50ms);
+
+  ASSERT_FALSE(filter.insert(makeHash(1)));
+}
+
+/**
+ * @given filter with pending hash
+ * @when the hash is released
+ * @then it is accepted again
+ */
+TEST(TransactionFilterTest, ReleasedHashAccepted) {
+  TransactionFilter filter(1h, 4);
+
+  ASSERT_TRUE(filter.insert(makeHash(1)));
+  filter.release(makeHash(1));
+
+  ASSERT_TRUE(filter.insert(makeHash(1)));
+  ASSERT_EQ(0, filter.duplicates());
+}
+
+/**
+ * @given filter
+ * @when the same hashes are inserted from several threads
+ * @then every hash is accepted exactly once
+ */
+TEST(TransactionFilterTest, ConcurrentInsert) {
+  TransactionFilter filter(1h, 4);
+  const size_t threads_number = 4;
+  const size_t hashes_number = 200;
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < threads_number; ++t) {
+    threads.emplace_back([&filter] {
+      for (size_t i = 0; i < hashes_number; ++i) {
+        hash256_t hash{};
+        hash[0] = i % 256;
+        hash[1] = i / 256;
+        filter.insert(hash);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(hashes_number, filter.accepted());
+  ASSERT_EQ(hashes_number * (threads_number - 1), filter.duplicates());
+}
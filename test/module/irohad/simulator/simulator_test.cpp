@@ -31,8 +31,10 @@ using namespace iroha::simulator;
 using namespace iroha::network;
 using namespace framework::test_subscriber;
 
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnArg;
+using ::testing::ReturnRef;
 using ::testing::A;
 using ::testing::_;
 
@@ -44,11 +46,16 @@ class SimulatorTest : public ::testing::Test {
     query = std::make_shared<MockBlockQuery>();
     ordering_gate = std::make_shared<MockOrderingGate>();
     crypto_provider = std::make_shared<MockCryptoProvider>();
+    write_sets = std::make_shared<WriteSetCache>(1);
   }
 
   void init() {
-    simulator = std::make_shared<Simulator>(
-        ordering_gate, validator, factory, query, crypto_provider);
+    simulator = std::make_shared<Simulator>(ordering_gate,
+                                            validator,
+                                            factory,
+                                            query,
+                                            crypto_provider,
+                                            write_sets);
   }
 
   std::shared_ptr<MockStatefulValidator> validator;
@@ -56,6 +63,7 @@ class SimulatorTest : public ::testing::Test {
   std::shared_ptr<MockBlockQuery> query;
   std::shared_ptr<MockOrderingGate> ordering_gate;
   std::shared_ptr<MockCryptoProvider> crypto_provider;
+  std::shared_ptr<WriteSetCache> write_sets;
 
   std::shared_ptr<Simulator> simulator;
 };
@@ -77,7 +85,13 @@ TEST_F(SimulatorTest, ValidWhenPreviousBlock) {
   model::Block block;
   block.height = proposal.height - 1;
 
-  EXPECT_CALL(*factory, createTemporaryWsv()).Times(1);
+  WriteSet write_set(3);
+  EXPECT_CALL(*factory, createTemporaryWsv())
+      .WillOnce(Invoke([&write_set]() -> std::unique_ptr<TemporaryWsv> {
+        auto wsv = std::make_unique<MockTemporaryWsv>();
+        EXPECT_CALL(*wsv, writeSet()).WillOnce(ReturnRef(write_set));
+        return std::move(wsv);
+      }));
 
   EXPECT_CALL(*query, getTopBlocks(1))
       .WillOnce(Return(rxcpp::observable<>::just(block)));
@@ -101,15 +115,22 @@ TEST_F(SimulatorTest, ValidWhenPreviousBlock) {
 
   auto block_wrapper =
       make_test_subscriber<CallExact>(simulator->on_block(), 1);
-  block_wrapper.subscribe([&proposal](auto block) {
+  hash256_t block_hash;
+  block_wrapper.subscribe([&proposal, &block_hash](auto block) {
     ASSERT_EQ(block.height, proposal.height);
     ASSERT_EQ(block.transactions, proposal.transactions);
+    block_hash = block.hash;
   });
 
   simulator->process_proposal(proposal);
 
   ASSERT_TRUE(proposal_wrapper.validate());
   ASSERT_TRUE(block_wrapper.validate());
+
+  // changes of verified proposal are kept for the block
+  auto kept = write_sets->extract(block_hash);
+  ASSERT_TRUE(kept);
+  ASSERT_EQ(kept->size(), write_set.size());
 }
 
 TEST_F(SimulatorTest, FailWhenNoBlock) {
@@ -182,3 +203,102 @@ TEST_F(SimulatorTest, FailWhenSameAsProposalHeight) {
   ASSERT_TRUE(proposal_wrapper.validate());
   ASSERT_TRUE(block_wrapper.validate());
 }
+
+class SpeculativeSimulatorTest : public SimulatorTest {
+ public:
+  void SetUp() override {
+    SimulatorTest::SetUp();
+    top_block.height = 1;
+    first_changes = WriteSet(1);
+    all_changes = WriteSet(3);
+
+    EXPECT_CALL(*factory, createTemporaryWsv())
+        .WillOnce(Invoke([this]() -> std::unique_ptr<TemporaryWsv> {
+          auto wsv = std::make_unique<MockTemporaryWsv>();
+          EXPECT_CALL(*wsv, writeSet()).WillOnce(ReturnRef(first_changes));
+          return std::move(wsv);
+        }))
+        .WillOnce(Invoke([this]() -> std::unique_ptr<TemporaryWsv> {
+          // overlay of ledger and changes of uncommitted block
+          auto wsv = std::make_unique<MockTemporaryWsv>();
+          EXPECT_CALL(*wsv, replay(_)).WillOnce(Return(true));
+          EXPECT_CALL(*wsv, writeSet()).WillOnce(ReturnRef(all_changes));
+          return std::move(wsv);
+        }));
+    EXPECT_CALL(*validator, validate(_, _))
+        .Times(2)
+        .WillRepeatedly(ReturnArg<0>());
+    EXPECT_CALL(*ordering_gate, on_proposal())
+        .WillOnce(Return(rxcpp::observable<>::empty<Proposal>()));
+
+    init();
+    simulator->on_block().subscribe(
+        [this](auto block) { blocks.push_back(block); });
+  }
+
+  /**
+   * Process proposal 2 on top of committed block 1, then proposal 3
+   * while block 2 is not committed
+   */
+  void processTwoRounds() {
+    auto first = model::Proposal(std::vector<model::Transaction>(1));
+    first.height = 2;
+    auto second = model::Proposal(std::vector<model::Transaction>(2));
+    second.height = 3;
+
+    EXPECT_CALL(*query, getTopBlocks(1))
+        .Times(2)
+        .WillRepeatedly(Return(rxcpp::observable<>::just(top_block)));
+    simulator->process_proposal(first);
+    simulator->process_proposal(second);
+  }
+
+  model::Block top_block;
+  WriteSet first_changes, all_changes;
+  std::vector<model::Block> blocks;
+};
+
+/**
+ * @given block 2 created by simulator and not committed yet
+ * @when proposal 3 is received and then block 2 is committed
+ * @then proposal 3 is validated on top of block 2 changes and its block
+ * is created only after the commit
+ */
+TEST_F(SpeculativeSimulatorTest, ProposalPassedOnCommit) {
+  EXPECT_CALL(*crypto_provider, sign(A<Block &>())).Times(2);
+
+  processTwoRounds();
+  ASSERT_EQ(blocks.size(), 1);
+
+  EXPECT_CALL(*query, getTopBlocks(1))
+      .WillOnce(Return(rxcpp::observable<>::just(blocks.at(0))));
+  simulator->process_commit();
+
+  ASSERT_EQ(blocks.size(), 2);
+  ASSERT_EQ(blocks.at(1).height, 3);
+  ASSERT_EQ(blocks.at(1).prev_hash, blocks.at(0).hash);
+  // only changes of proposal 3 are kept for its block
+  auto kept = write_sets->extract(blocks.at(1).hash);
+  ASSERT_TRUE(kept);
+  ASSERT_EQ(kept->size(), all_changes.size() - first_changes.size());
+}
+
+/**
+ * @given proposal 3 validated on top of uncommitted block 2
+ * @when other block 2 is committed
+ * @then speculative result is discarded
+ */
+TEST_F(SpeculativeSimulatorTest, ProposalDiscardedOnOtherCommit) {
+  EXPECT_CALL(*crypto_provider, sign(A<Block &>())).Times(1);
+
+  processTwoRounds();
+
+  model::Block other_block;
+  other_block.height = 2;
+  other_block.hash.fill(1);
+  EXPECT_CALL(*query, getTopBlocks(1))
+      .WillOnce(Return(rxcpp::observable<>::just(other_block)));
+  simulator->process_commit();
+
+  ASSERT_EQ(blocks.size(), 1);
+}
@@ -19,6 +19,7 @@
 #include "module/irohad/network/network_mocks.hpp"
 #include "module/irohad/validation/validation_mocks.hpp"
 
+#include "crypto/hash.hpp"
 #include "framework/test_subscriber.hpp"
 #include "synchronizer/impl/synchronizer_impl.hpp"
 #include "validation/chain_validator.hpp"
@@ -42,17 +43,22 @@ class SynchronizerTest : public ::testing::Test {
     mutable_factory = std::make_shared<MockMutableFactory>();
     block_loader = std::make_shared<MockBlockLoader>();
     consensus_gate = std::make_shared<MockConsensusGate>();
+    write_sets = std::make_shared<WriteSetCache>(1);
   }
 
   void init() {
-    synchronizer = std::make_shared<SynchronizerImpl>(
-        consensus_gate, chain_validator, mutable_factory, block_loader);
+    synchronizer = std::make_shared<SynchronizerImpl>(consensus_gate,
+                                                      chain_validator,
+                                                      mutable_factory,
+                                                      block_loader,
+                                                      write_sets);
   }
 
   std::shared_ptr<MockChainValidator> chain_validator;
   std::shared_ptr<MockMutableFactory> mutable_factory;
   std::shared_ptr<MockBlockLoader> block_loader;
   std::shared_ptr<MockConsensusGate> consensus_gate;
+  std::shared_ptr<WriteSetCache> write_sets;
 
   std::shared_ptr<SynchronizerImpl> synchronizer;
 };
@@ -102,6 +108,82 @@ TEST_F(SynchronizerTest, ValidWhenSingleCommitSynchronized) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given block created by this peer with its changes kept by simulator
+ * @when the block is committed
+ * @then known changes are applied instead of block execution
+ */
+TEST_F(SynchronizerTest, OwnBlockAppliedFromWriteSet) {
+  Block test_block;
+  test_block.height = 5;
+  test_block.hash = hash(test_block);
+  write_sets->insert(test_block.hash, WriteSet(2));
+
+  DefaultValue<std::unique_ptr<MutableStorage>>::SetFactory(
+      &createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
+
+  EXPECT_CALL(*mutable_factory, commit_(_)).Times(1);
+
+  EXPECT_CALL(*chain_validator, validateBlock(test_block, _, _))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*chain_validator, validateBlock(test_block, _)).Times(0);
+
+  EXPECT_CALL(*block_loader, retrieveBlocks(_)).Times(0);
+
+  EXPECT_CALL(*consensus_gate, on_commit())
+      .WillOnce(Return(rxcpp::observable<>::empty<Block>()));
+
+  init();
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe();
+
+  synchronizer->process_commit(test_block);
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_FALSE(write_sets->extract(test_block.hash));
+}
+
+/**
+ * @given changes kept for a block with the same hash field
+ * @when committed block content does not match its hash
+ * @then block is executed as usual
+ */
+TEST_F(SynchronizerTest, WriteSetIgnoredWhenHashMismatch) {
+  Block test_block;
+  test_block.height = 5;
+  test_block.hash = hash(test_block);
+  write_sets->insert(test_block.hash, WriteSet(2));
+  test_block.height = 6;
+
+  DefaultValue<std::unique_ptr<MutableStorage>>::SetFactory(
+      &createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
+
+  EXPECT_CALL(*mutable_factory, commit_(_)).Times(1);
+
+  EXPECT_CALL(*chain_validator, validateBlock(_, _, _)).Times(0);
+  EXPECT_CALL(*chain_validator, validateBlock(test_block, _))
+      .WillOnce(Return(true));
+
+  EXPECT_CALL(*block_loader, retrieveBlocks(_)).Times(0);
+
+  EXPECT_CALL(*consensus_gate, on_commit())
+      .WillOnce(Return(rxcpp::observable<>::empty<Block>()));
+
+  init();
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe();
+
+  synchronizer->process_commit(test_block);
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 TEST_F(SynchronizerTest, ValidWhenBadStorage) {
   // commit from consensus => storage not created => no commit
   Block test_block;
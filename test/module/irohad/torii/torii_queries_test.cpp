@@ -70,8 +70,11 @@ class ToriiQueriesTest : public testing::Test {
       auto pb_tx_factory =
           std::make_shared<iroha::model::converters::PbTransactionFactory>();
 
-      auto command_service =
-          std::make_unique<torii::CommandService>(pb_tx_factory, tx_processor, storageMock);
+      auto ordering_gate = std::make_shared<MockOrderingGate>();
+      EXPECT_CALL(*ordering_gate, queueDepth()).WillRepeatedly(Return(0));
+      EXPECT_CALL(*ordering_gate, overloaded()).WillRepeatedly(Return(false));
+      auto command_service = std::make_unique<torii::CommandService>(
+          pb_tx_factory, tx_processor, storageMock, ordering_gate);
 
       //----------- Query Service ----------
 
@@ -39,11 +39,13 @@ constexpr int Port = 50051;
 
 constexpr size_t TimesToriiBlocking = 5;
 constexpr size_t TimesToriiNonBlocking = 5;
+constexpr size_t FullQueueDepth = 100;
 
 using ::testing::Return;
 using ::testing::A;
 using ::testing::_;
 using ::testing::AtLeast;
+using ::testing::Invoke;
 
 using namespace iroha::network;
 using namespace iroha::validation;
@@ -91,8 +93,13 @@ class ToriiServiceTest : public testing::Test {
               pcsMock, statelessValidatorMock);
       auto pb_tx_factory =
           std::make_shared<iroha::model::converters::PbTransactionFactory>();
+      orderingGateMock = std::make_shared<MockOrderingGate>();
+      EXPECT_CALL(*orderingGateMock, queueDepth())
+          .WillRepeatedly(Invoke([this] { return queue_depth.load(); }));
+      EXPECT_CALL(*orderingGateMock, overloaded())
+          .WillRepeatedly(Invoke([this] { return overloaded.load(); }));
       auto command_service = std::make_unique<torii::CommandService>(
-          pb_tx_factory, tx_processor, storageMock);
+          pb_tx_factory, tx_processor, storageMock, orderingGateMock);
 
       //----------- Query Service ----------
       auto qpf = std::make_unique<iroha::model::QueryProcessingFactory>(
@@ -139,8 +146,74 @@ class ToriiServiceTest : public testing::Test {
 
   std::shared_ptr<CustomPeerCommunicationServiceMock> pcsMock;
   std::shared_ptr<MockStatelessValidator> statelessValidatorMock;
+  std::shared_ptr<MockOrderingGate> orderingGateMock;
+  std::atomic<size_t> queue_depth{0};
+  std::atomic<bool> overloaded{false};
 };
 
+/**
+ * @given ordering service which rejected transactions because its queue is
+ * full
+ * @when transaction is sent to Torii
+ * @then it is rejected with retryable status before validation,
+ * and queue depth is reported in status responses
+ */
+TEST_F(ToriiServiceTest, ToriiRejectsWhenQueueIsFull) {
+  EXPECT_CALL(*statelessValidatorMock,
+              validate(A<const iroha::model::Transaction &>()))
+      .Times(0);
+  queue_depth = FullQueueDepth;
+  overloaded = true;
+
+  auto new_tx = iroha::protocol::Transaction();
+  new_tx.mutable_payload()->set_creator_account_id("accountA");
+
+  auto status = torii::CommandSyncClient(Ip, Port).Torii(new_tx);
+  ASSERT_EQ(grpc::StatusCode::RESOURCE_EXHAUSTED, status.error_code());
+
+  iroha::model::converters::PbTransactionFactory tx_factory;
+  iroha::protocol::TxStatusRequest tx_request;
+  tx_request.set_tx_hash(
+      iroha::hash(*tx_factory.deserialize(new_tx)).to_string());
+  iroha::protocol::ToriiResponse toriiResponse;
+  torii::CommandSyncClient(Ip, Port).Status(tx_request, toriiResponse);
+
+  ASSERT_EQ(iroha::protocol::TxStatus::NOT_RECEIVED, toriiResponse.tx_status());
+  ASSERT_EQ(FullQueueDepth, toriiResponse.queue_depth());
+}
+
+/**
+ * @given ordering service which rejected transactions because its queue is
+ * full
+ * @when the queue drains and the backoff ends
+ * @then Torii accepts transactions again
+ */
+TEST_F(ToriiServiceTest, ToriiAcceptsWhenQueueDrains) {
+  EXPECT_CALL(*statelessValidatorMock,
+              validate(A<const iroha::model::Transaction &>()))
+      .WillOnce(Return(true));
+  queue_depth = FullQueueDepth;
+  overloaded = true;
+
+  auto new_tx = iroha::protocol::Transaction();
+  new_tx.mutable_payload()->set_creator_account_id("accountA");
+  ASSERT_EQ(grpc::StatusCode::RESOURCE_EXHAUSTED,
+            torii::CommandSyncClient(Ip, Port).Torii(new_tx).error_code());
+
+  queue_depth = 0;
+  overloaded = false;
+  ASSERT_TRUE(torii::CommandSyncClient(Ip, Port).Torii(new_tx).ok());
+
+  iroha::model::converters::PbTransactionFactory tx_factory;
+  iroha::protocol::TxStatusRequest tx_request;
+  tx_request.set_tx_hash(
+      iroha::hash(*tx_factory.deserialize(new_tx)).to_string());
+  iroha::protocol::ToriiResponse toriiResponse;
+  torii::CommandSyncClient(Ip, Port).Status(tx_request, toriiResponse);
+  ASSERT_EQ(iroha::protocol::TxStatus::STATELESS_VALIDATION_SUCCESS,
+            toriiResponse.tx_status());
+}
+
 TEST_F(ToriiServiceTest, StatusWhenTxWasNotReceivedBlocking) {
   std::vector<iroha::model::Transaction> txs;
   std::vector<std::string> tx_hashes;
@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include <atomic>
+
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 #include "module/irohad/model/model_mocks.hpp"
 #include "validation/impl/chain_validator_impl.hpp"
@@ -26,6 +28,7 @@ using namespace iroha::ametsuchi;
 
 using ::testing::_;
 using ::testing::A;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::InvokeArgument;
 using ::testing::ByRef;
@@ -34,7 +37,8 @@ class ChainValidationTest : public ::testing::Test {
  public:
 
   void SetUp() override {
-    validator = std::make_shared<ChainValidatorImpl>();
+    crypto_provider = std::make_shared<MockCryptoProvider>();
+    validator = std::make_shared<ChainValidatorImpl>(crypto_provider);
     storage = std::make_shared<MockMutableStorage>();
     query = std::make_shared<MockWsvQuery>();
 
@@ -52,6 +56,7 @@ class ChainValidationTest : public ::testing::Test {
   Block block;
   hash256_t hash;
 
+  std::shared_ptr<MockCryptoProvider> crypto_provider;
   std::shared_ptr<ChainValidatorImpl> validator;
   std::shared_ptr<MockMutableStorage> storage;
   std::shared_ptr<MockWsvQuery> query;
@@ -119,8 +124,145 @@ TEST_F(ChainValidationTest, ValidWhenValidateChainFromOnePeer) {
 
   auto block_observable = rxcpp::observable<>::just(block);
 
+  EXPECT_CALL(*crypto_provider, verify(A<const Block &>()))
+      .WillOnce(Return(true));
+
   EXPECT_CALL(*storage, apply(block, _))
       .WillOnce(InvokeArgument<1>(ByRef(block), ByRef(*query), ByRef(hash)));
 
   ASSERT_TRUE(validator->validateChain(block_observable, *storage));
 }
+
+/**
+ * @given chain of blocks linked by hashes
+ * @when the chain is validated
+ * @then all blocks are verified and applied in order
+ */
+TEST_F(ChainValidationTest, ValidWhenValidateLongChain) {
+  std::vector<Block> blocks;
+  for (auto i = 0; i < 100; ++i) {
+    Block next = block;
+    next.height = i + 1;
+    next.hash.fill(0);
+    next.hash.at(0) = i + 1;
+    if (not blocks.empty()) {
+      next.prev_hash = blocks.back().hash;
+    }
+    blocks.push_back(next);
+  }
+
+  EXPECT_CALL(*crypto_provider, verify(A<const Block &>()))
+      .Times(blocks.size())
+      .WillRepeatedly(Return(true));
+
+  std::vector<uint64_t> applied;
+  EXPECT_CALL(*storage, apply(_, _))
+      .Times(blocks.size())
+      .WillRepeatedly(Invoke([&applied](const Block &block, auto) {
+        applied.push_back(block.height);
+        return true;
+      }));
+
+  ASSERT_TRUE(validator->validateChain(rxcpp::observable<>::iterate(blocks),
+                                       *storage));
+  ASSERT_EQ(applied.size(), blocks.size());
+  ASSERT_TRUE(std::is_sorted(applied.begin(), applied.end()));
+}
+
+/**
+ * @given chain where second block does not refer to the first one
+ * @when the chain is validated
+ * @then only the first block is applied and chain is invalid
+ */
+TEST_F(ChainValidationTest, FailWhenChainLinkBroken) {
+  Block second = block;
+  second.height = block.height + 1;
+  second.prev_hash.fill(7);
+
+  EXPECT_CALL(*crypto_provider, verify(A<const Block &>()))
+      .WillRepeatedly(Return(true));
+
+  EXPECT_CALL(*storage, apply(block, _)).WillOnce(Return(true));
+  EXPECT_CALL(*storage, apply(second, _)).Times(0);
+
+  ASSERT_FALSE(validator->validateChain(
+      rxcpp::observable<>::iterate(std::vector<Block>{block, second}),
+      *storage));
+}
+
+/**
+ * @given block with invalid signatures
+ * @when the chain is validated
+ * @then the block is not applied
+ */
+TEST_F(ChainValidationTest, FailWhenBadSignatures) {
+  EXPECT_CALL(*crypto_provider, verify(A<const Block &>()))
+      .WillOnce(Return(false));
+
+  EXPECT_CALL(*storage, apply(_, _)).Times(0);
+
+  ASSERT_FALSE(
+      validator->validateChain(rxcpp::observable<>::just(block), *storage));
+}
+
+/**
+ * @given block with transaction and merkle root not matching it
+ * @when the block or the chain of it is validated
+ * @then the block is not applied
+ */
+TEST_F(ChainValidationTest, FailWhenMerkleRootMismatch) {
+  block.transactions.emplace_back();
+  block.merkle_root.fill(1);
+
+  EXPECT_CALL(*crypto_provider, verify(A<const Block &>()))
+      .WillRepeatedly(Return(true));
+
+  EXPECT_CALL(*storage, apply(_, _)).Times(0);
+
+  ASSERT_FALSE(validator->validateBlock(block, *storage));
+  ASSERT_FALSE(
+      validator->validateChain(rxcpp::observable<>::just(block), *storage));
+}
+
+/**
+ * @given long chain with invalid first block
+ * @when the chain is validated
+ * @then the chain is not received further than the verification window
+ */
+TEST_F(ChainValidationTest, ChainCancelledAfterInvalidBlock) {
+  constexpr size_t chain_size = 10000;
+  std::atomic<size_t> sent(0);
+  auto chain = rxcpp::observable<>::create<Block>([&](auto subscriber) {
+    for (size_t i = 0; i < chain_size and subscriber.is_subscribed(); ++i) {
+      subscriber.on_next(block);
+      ++sent;
+    }
+    subscriber.on_completed();
+  });
+
+  EXPECT_CALL(*crypto_provider, verify(A<const Block &>()))
+      .WillRepeatedly(Return(false));
+  EXPECT_CALL(*storage, apply(_, _)).Times(0);
+
+  ASSERT_FALSE(validator->validateChain(chain, *storage));
+  ASSERT_LT(sent, chain_size);
+}
+
+/**
+ * @given chain of blocks and storage which fails with exception
+ * @when the chain is validated
+ * @then the exception is passed to the caller
+ */
+TEST_F(ChainValidationTest, StorageExceptionIsPropagated) {
+  EXPECT_CALL(*crypto_provider, verify(A<const Block &>()))
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*storage, apply(_, _))
+      .WillOnce(Invoke([](const Block &, auto) -> bool {
+        throw std::runtime_error("storage failure");
+      }));
+
+  ASSERT_THROW(validator->validateChain(
+                   rxcpp::observable<>::iterate(std::vector<Block>(100, block)),
+                   *storage),
+               std::runtime_error);
+}
@@ -17,11 +17,14 @@
 
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 
+#include "crypto/hash.hpp"
+
 #include <model/queries/responses/account_assets_response.hpp>
 #include "model/queries/responses/account_response.hpp"
 #include "model/queries/responses/asset_response.hpp"
 #include "model/queries/responses/error_response.hpp"
 #include "model/queries/responses/roles_response.hpp"
+#include "model/queries/responses/transaction_proof_response.hpp"
 #include "model/query_execution.hpp"
 #include "model/permissions.hpp"
 
@@ -337,3 +340,60 @@ TEST(QueryExecutor, get_role_permissions) {
   // TODO: add more test cases
 }
 
+
+TEST(QueryExecutor, get_transaction_proof) {
+  auto wsv_queries = std::make_shared<MockWsvQuery>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+
+  auto query_proccesor =
+      iroha::model::QueryProcessingFactory(wsv_queries, block_queries);
+
+  set_default_ametsuchi(*wsv_queries, *block_queries);
+
+  Block block;
+  block.height = 3;
+  for (auto i = 0; i < 5; ++i) {
+    Transaction tx;
+    tx.creator_account_id = ACCOUNT_ID;
+    tx.tx_counter = i;
+    block.transactions.push_back(tx);
+  }
+  block.txs_number = block.transactions.size();
+  auto tx_hashes = iroha::hash(block.transactions);
+  block.merkle_root = iroha::merkleRoot(tx_hashes);
+
+  EXPECT_CALL(*block_queries, getBlockByTxHashSync(_))
+      .WillRepeatedly(Return(boost::none));
+  EXPECT_CALL(*block_queries, getBlockByTxHashSync(tx_hashes.at(3).to_string()))
+      .WillRepeatedly(Return(block));
+
+  // Valid case: proof of committed transaction leads to block merkle root
+  auto query = std::make_shared<GetTransactionProof>(tx_hashes.at(3));
+  query->creator_account_id = ADMIN_ID;
+  auto response = query_proccesor.execute(query);
+  auto cast_resp =
+      std::dynamic_pointer_cast<TransactionProofResponse>(response);
+  ASSERT_NE(cast_resp, nullptr);
+  ASSERT_EQ(block.height, cast_resp->height);
+  ASSERT_EQ(block.merkle_root, cast_resp->merkle_root);
+  ASSERT_TRUE(iroha::verifyMerkleProof(tx_hashes.at(3),
+                                       cast_resp->proof,
+                                       block.merkle_root,
+                                       block.txs_number));
+
+  // Non valid cases:
+  // 1. Unknown transaction
+  query->tx_hash.fill(1);
+  response = query_proccesor.execute(query);
+  auto err_resp = std::dynamic_pointer_cast<ErrorResponse>(response);
+  ASSERT_NE(err_resp, nullptr);
+  ASSERT_EQ(ErrorResponse::NO_TRANSACTION, err_resp->reason);
+
+  // 2. No rights to ask transactions
+  query->tx_hash = tx_hashes.at(3);
+  query->creator_account_id = ADVERSARY_ID;
+  response = query_proccesor.execute(query);
+  err_resp = std::dynamic_pointer_cast<ErrorResponse>(response);
+  ASSERT_NE(err_resp, nullptr);
+  ASSERT_EQ(ErrorResponse::STATEFUL_INVALID, err_resp->reason);
+}
@@ -0,0 +1,223 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <map>
+#include <mutex>
+#include "model/commands/transfer_asset.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "validation/impl/stateful_validator_impl.hpp"
+
+using namespace iroha;
+using namespace iroha::model;
+using namespace iroha::validation;
+using namespace iroha::ametsuchi;
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+
+/**
+ * Temporary wsv which keeps balances in memory,
+ * every instance starts from the same ledger state
+ */
+class BalancesWsv : public TemporaryWsv {
+ public:
+  BalancesWsv(std::map<std::string, Amount> balances, WsvQuery &queries)
+      : initial_(balances), balances_(std::move(balances)), queries_(queries) {
+    ON_CALL(command_, upsertAccountAsset(_))
+        .WillByDefault(Invoke([this](const AccountAsset &asset) {
+          balances_[asset.account_id] = asset.balance;
+          return true;
+        }));
+  }
+
+  bool apply(const Transaction &tx,
+             std::function<bool(const Transaction &, WsvQuery &)> function)
+      override {
+    if (not function(tx, queries_)) {
+      return false;
+    }
+    auto state = balances_;
+    for (const auto &command : tx.commands) {
+      auto transfer = static_cast<const TransferAsset &>(*command);
+      auto src = nonstd::make_optional(state[transfer.src_account_id])
+          - transfer.amount;
+      auto dest = nonstd::make_optional(state[transfer.dest_account_id])
+          + transfer.amount;
+      if (not src or not dest) {
+        return false;
+      }
+      state[transfer.src_account_id] = *src;
+      state[transfer.dest_account_id] = *dest;
+      write_set_.push_back(change(transfer.src_account_id, *src));
+      write_set_.push_back(change(transfer.dest_account_id, *dest));
+    }
+    balances_ = state;
+    return true;
+  }
+
+  bool replay(const WriteSet &write_set) override {
+    if (not ametsuchi::replay(write_set, command_)) {
+      return false;
+    }
+    write_set_.insert(write_set_.end(), write_set.begin(), write_set.end());
+    return true;
+  }
+
+  const WriteSet &writeSet() const override {
+    return write_set_;
+  }
+
+  void reset() override {
+    balances_ = initial_;
+    write_set_.clear();
+  }
+
+  const std::map<std::string, Amount> &balances() const {
+    return balances_;
+  }
+
+ private:
+  static std::function<bool(WsvCommand &)> change(std::string account_id,
+                                                  Amount balance) {
+    return [account_id, balance](WsvCommand &command) {
+      AccountAsset asset;
+      asset.account_id = account_id;
+      asset.asset_id = "coin#test";
+      asset.balance = balance;
+      return command.upsertAccountAsset(asset);
+    };
+  }
+
+  std::map<std::string, Amount> initial_;
+  std::map<std::string, Amount> balances_;
+  WsvQuery &queries_;
+  WriteSet write_set_;
+  ::testing::NiceMock<MockWsvCommand> command_;
+};
+
+class StatefulValidatorTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    Account account;
+    account.quorum = 1;
+    EXPECT_CALL(queries, getAccount(_)).WillRepeatedly(Return(account));
+    EXPECT_CALL(queries, getSignatories(_))
+        .WillRepeatedly(Return(std::vector<pubkey_t>{pubkey_t{}}));
+
+    for (auto i = 0; i < 10; ++i) {
+      balances[account_id(i)] = Amount(3);
+    }
+    factory = std::make_shared<MockTemporaryFactory>();
+  }
+
+  std::string account_id(int i) {
+    return "user" + std::to_string(i) + "@test";
+  }
+
+  Transaction makeTransfer(int src, int dest, int amount) {
+    Transaction tx;
+    tx.creator_account_id = account_id(src);
+    tx.signatures.emplace_back();
+    tx.commands.push_back(std::make_shared<TransferAsset>(
+        account_id(src), account_id(dest), "coin#test", Amount(amount)));
+    return tx;
+  }
+
+  MockWsvQuery queries;
+  std::map<std::string, Amount> balances;
+  std::shared_ptr<MockTemporaryFactory> factory;
+};
+
+/**
+ * @given proposal of transfers where some of them spend more than balance
+ * depending on the previous transfers
+ * @when it is validated sequentially and in parallel
+ * @then accepted transactions and resulting state are the same
+ */
+TEST_F(StatefulValidatorTest, ParallelValidationSameAsSequential) {
+  std::vector<Transaction> txs;
+  std::srand(42);
+  for (auto i = 0; i < 200; ++i) {
+    txs.push_back(makeTransfer(
+        std::rand() % 10, std::rand() % 10, std::rand() % 4 + 1));
+  }
+  Proposal proposal(txs);
+  proposal.height = 2;
+
+  BalancesWsv sequential_wsv(balances, queries);
+  auto expected = StatefulValidatorImpl().validate(proposal, sequential_wsv);
+  ASSERT_GT(expected.transactions.size(), 0);
+  ASSERT_LT(expected.transactions.size(), proposal.transactions.size());
+
+  EXPECT_CALL(*factory, createTemporaryWsv())
+      .WillRepeatedly(Invoke([this]() -> std::unique_ptr<TemporaryWsv> {
+        return std::make_unique<BalancesWsv>(balances, queries);
+      }));
+  BalancesWsv parallel_wsv(balances, queries);
+  auto validated =
+      StatefulValidatorImpl(factory, 4).validate(proposal, parallel_wsv);
+
+  ASSERT_EQ(expected.height, validated.height);
+  ASSERT_EQ(expected.transactions, validated.transactions);
+  // changes of all workers are merged to given wsv
+  ASSERT_EQ(sequential_wsv.balances(), parallel_wsv.balances());
+}
+
+/**
+ * @given proposal with independent transfers
+ * @when temporary wsv for workers can not be created
+ * @then transactions are validated with given wsv
+ */
+TEST_F(StatefulValidatorTest, NoWorkerWsv) {
+  Proposal proposal(std::vector<Transaction>{
+      makeTransfer(0, 1, 1), makeTransfer(2, 3, 4), makeTransfer(4, 5, 3)});
+
+  EXPECT_CALL(*factory, createTemporaryWsv())
+      .WillRepeatedly(Invoke([] { return nullptr; }));
+  BalancesWsv wsv(balances, queries);
+  auto validated = StatefulValidatorImpl(factory, 4).validate(proposal, wsv);
+
+  std::vector<Transaction> expected = {proposal.transactions.at(0),
+                                       proposal.transactions.at(2)};
+  ASSERT_EQ(expected, validated.transactions);
+}
+
+/**
+ * @given validator with 4 workers
+ * @when two proposals of independent transfers are validated
+ * @then wsv of workers are created for the first proposal only and
+ * both proposals are validated from the ledger state
+ */
+TEST_F(StatefulValidatorTest, WorkerWsvReused) {
+  Proposal proposal(std::vector<Transaction>{makeTransfer(0, 1, 3),
+                                             makeTransfer(2, 3, 3),
+                                             makeTransfer(4, 5, 3),
+                                             makeTransfer(6, 7, 3)});
+
+  EXPECT_CALL(*factory, createTemporaryWsv())
+      .Times(3)
+      .WillRepeatedly(Invoke([this]() -> std::unique_ptr<TemporaryWsv> {
+        return std::make_unique<BalancesWsv>(balances, queries);
+      }));
+  StatefulValidatorImpl validator(factory, 4);
+  for (auto i = 0; i < 2; ++i) {
+    BalancesWsv wsv(balances, queries);
+    auto validated = validator.validate(proposal, wsv);
+    ASSERT_EQ(proposal.transactions, validated.transactions);
+  }
+}
@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "model/commands/add_peer.hpp"
+#include "model/commands/add_signatory.hpp"
+#include "model/commands/transfer_asset.hpp"
+#include "validation/impl/transaction_partitioner.hpp"
+
+using namespace iroha;
+using namespace iroha::model;
+using namespace iroha::validation;
+
+Transaction makeTransfer(const std::string &src, const std::string &dest) {
+  Transaction tx;
+  tx.creator_account_id = src;
+  tx.commands.push_back(
+      std::make_shared<TransferAsset>(src, dest, "coin#test", Amount(1)));
+  return tx;
+}
+
+TEST(TransactionPartitionerTest, AccessSetOfTransfer) {
+  auto set = TransactionPartitioner().accessSet(makeTransfer("a@t", "b@t"));
+  ASSERT_FALSE(set.global);
+  ASSERT_EQ(std::set<std::string>({"account:a@t", "account:b@t"}),
+            set.writes);
+  ASSERT_EQ(std::set<std::string>({"account:a@t", "asset:coin#test"}),
+            set.reads);
+}
+
+TEST(TransactionPartitionerTest, EmptyProposal) {
+  ASSERT_TRUE(TransactionPartitioner().partition({}).empty());
+}
+
+/**
+ * @given transfers a->b, c->d, b->e, f->g
+ * @when they are partitioned
+ * @then transfers sharing account b are in one group, others are alone
+ */
+TEST(TransactionPartitionerTest, TransfersSharingAccountAreGrouped) {
+  std::vector<Transaction> txs = {makeTransfer("a@t", "b@t"),
+                                  makeTransfer("c@t", "d@t"),
+                                  makeTransfer("b@t", "e@t"),
+                                  makeTransfer("f@t", "g@t")};
+  auto groups = TransactionPartitioner().partition(txs);
+  std::vector<std::vector<size_t>> expected = {{0, 2}, {1}, {3}};
+  ASSERT_EQ(expected, groups);
+}
+
+/**
+ * @given two transactions which only read the same asset
+ * @when they are partitioned
+ * @then they are independent
+ */
+TEST(TransactionPartitionerTest, SharedReadsAreIndependent) {
+  std::vector<Transaction> txs = {makeTransfer("a@t", "b@t"),
+                                  makeTransfer("c@t", "d@t")};
+  ASSERT_EQ(2, TransactionPartitioner().partition(txs).size());
+}
+
+/**
+ * @given transactions adding the same signatory to different accounts
+ * @when they are partitioned
+ * @then they are in one group
+ */
+TEST(TransactionPartitionerTest, SameSignatoryIsConflict) {
+  pubkey_t key;
+  key.fill(1);
+  Transaction first, second;
+  first.creator_account_id = "a@t";
+  first.commands.push_back(std::make_shared<AddSignatory>("a@t", key));
+  second.creator_account_id = "b@t";
+  second.commands.push_back(std::make_shared<AddSignatory>("b@t", key));
+  ASSERT_EQ(1, TransactionPartitioner().partition({first, second}).size());
+}
+
+/**
+ * @given proposal with transaction changing peers
+ * @when it is partitioned
+ * @then all transactions are in one group
+ */
+TEST(TransactionPartitionerTest, GlobalCommandSerializesProposal) {
+  pubkey_t key;
+  Transaction add_peer;
+  add_peer.creator_account_id = "admin@t";
+  add_peer.commands.push_back(std::make_shared<AddPeer>(key, "localhost"));
+  std::vector<Transaction> txs = {
+      makeTransfer("a@t", "b@t"), add_peer, makeTransfer("c@t", "d@t")};
+  std::vector<std::vector<size_t>> expected = {{0, 1, 2}};
+  ASSERT_EQ(expected, TransactionPartitioner().partition(txs));
+}
@@ -44,6 +44,11 @@ namespace iroha {
 
       MOCK_METHOD2(validateBlock,
                    bool(const model::Block &, ametsuchi::MutableStorage &));
+
+      MOCK_METHOD3(validateBlock,
+                   bool(const model::Block &,
+                        const ametsuchi::WriteSet &,
+                        ametsuchi::MutableStorage &));
     };
   }  // namespace validation
 }  // namespace iroha
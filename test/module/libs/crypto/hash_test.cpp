@@ -146,3 +146,34 @@ TEST(Hash, sha3_512_RU_text_LOOP) {
                  res.c_str());
   }
 }
+
+TEST(Hash, sha3_256_batch_empty) {
+  ASSERT_TRUE(iroha::sha3_256_batch({}).empty());
+}
+
+/**
+ * @given messages around sha3-256 rate (136 bytes) boundaries
+ * @when they are hashed in batches of different size
+ * @then every digest equals the one computed by sha3_256
+ */
+TEST(Hash, sha3_256_batch_same_as_single) {
+  std::vector<size_t> lengths = {0, 1, 34, 135, 136, 137, 271, 272, 273, 1000};
+  for (size_t count = 1; count <= 17; ++count) {
+    std::vector<std::string> messages;
+    for (size_t i = 0; i < count; ++i) {
+      auto len = lengths.at((i * 7 + count) % lengths.size());
+      std::string msg(len, 0);
+      for (size_t j = 0; j < len; ++j) {
+        msg[j] = static_cast<char>(j * 31 + i);
+      }
+      messages.push_back(msg);
+    }
+
+    auto hashes = iroha::sha3_256_batch(messages);
+    ASSERT_EQ(messages.size(), hashes.size());
+    for (size_t i = 0; i < count; ++i) {
+      ASSERT_EQ(sha3_256(messages.at(i)), hashes.at(i))
+          << "count " << count << ", message " << i;
+    }
+  }
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "crypto/hash.hpp"
+#include "crypto/merkle.hpp"
+
+using iroha::hash256_t;
+using iroha::merkleProof;
+using iroha::merkleRoot;
+using iroha::verifyMerkleProof;
+
+std::vector<hash256_t> makeLeaves(size_t size) {
+  std::vector<hash256_t> leaves;
+  for (size_t i = 0; i < size; ++i) {
+    leaves.push_back(iroha::sha3_256(std::to_string(i)));
+  }
+  return leaves;
+}
+
+TEST(Merkle, EmptyTreeHasZeroRoot) {
+  ASSERT_EQ(hash256_t{}, merkleRoot({}));
+  ASSERT_FALSE(merkleProof({}, 0));
+}
+
+hash256_t hashLeaf(const hash256_t &leaf) {
+  std::string node(1, 0x00);
+  node.append(leaf.begin(), leaf.end());
+  return iroha::sha3_256(node);
+}
+
+TEST(Merkle, SingleLeafRoot) {
+  auto leaves = makeLeaves(1);
+  ASSERT_EQ(hashLeaf(leaves.front()), merkleRoot(leaves));
+}
+
+TEST(Merkle, RootOfTwoLeaves) {
+  auto leaves = makeLeaves(2);
+  auto left = hashLeaf(leaves.at(0));
+  auto right = hashLeaf(leaves.at(1));
+  std::string node(1, 0x01);
+  node.append(left.begin(), left.end());
+  node.append(right.begin(), right.end());
+  ASSERT_EQ(iroha::sha3_256(node), merkleRoot(leaves));
+}
+
+TEST(Merkle, RootDependsOnOrder) {
+  auto leaves = makeLeaves(4);
+  auto root = merkleRoot(leaves);
+  std::swap(leaves.at(1), leaves.at(2));
+  ASSERT_NE(root, merkleRoot(leaves));
+}
+
+/**
+ * @given trees with different number of leaves
+ * @when proof is built for each leaf
+ * @then proof is valid only for this leaf and this root
+ */
+TEST(Merkle, ProofOfEveryLeaf) {
+  for (size_t size = 1; size <= 33; ++size) {
+    auto leaves = makeLeaves(size);
+    auto root = merkleRoot(leaves);
+    for (size_t i = 0; i < size; ++i) {
+      auto proof = merkleProof(leaves, i);
+      ASSERT_TRUE(proof);
+      ASSERT_TRUE(verifyMerkleProof(leaves.at(i), *proof, root, size));
+      if (size > 1) {
+        ASSERT_FALSE(
+            verifyMerkleProof(leaves.at((i + 1) % size), *proof, root, size));
+      }
+    }
+    ASSERT_FALSE(merkleProof(leaves, size));
+  }
+}
+
+TEST(Merkle, TamperedProofIsRejected) {
+  auto leaves = makeLeaves(10);
+  auto root = merkleRoot(leaves);
+  auto proof = *merkleProof(leaves, 6);
+
+  auto wrong_path = proof;
+  wrong_path.path.front().at(0) ^= 1;
+  ASSERT_FALSE(verifyMerkleProof(leaves.at(6), wrong_path, root, 10));
+
+  auto short_path = proof;
+  short_path.path.pop_back();
+  ASSERT_FALSE(verifyMerkleProof(leaves.at(6), short_path, root, 10));
+
+  auto wrong_index = proof;
+  wrong_index.index = 7;
+  ASSERT_FALSE(verifyMerkleProof(leaves.at(6), wrong_index, root, 10));
+
+  ASSERT_FALSE(verifyMerkleProof(leaves.at(6), proof, root, 11));
+}
+
+/**
+ * @given tree of 4 leaves
+ * @when inner node is presented as a leaf of 2-leaves tree with its
+ * children as the path
+ * @then proof is rejected both by the leaves number and by the leaf prefix
+ */
+TEST(Merkle, InnerNodeIsNotLeaf) {
+  auto leaves = makeLeaves(4);
+  auto root = merkleRoot(leaves);
+  auto inner = *merkleProof(leaves, 0);
+
+  // inner node over leaves 0 and 1, sibling is the node over 2 and 3
+  iroha::MerkleProof forged;
+  forged.index = 0;
+  forged.leaves_number = 2;
+  forged.path = {inner.path.at(1)};
+  std::string node(1, 0x01);
+  auto left = hashLeaf(leaves.at(0));
+  node.append(left.begin(), left.end());
+  node.append(inner.path.at(0).begin(), inner.path.at(0).end());
+  auto fake_leaf = iroha::sha3_256(node);
+
+  ASSERT_FALSE(verifyMerkleProof(fake_leaf, forged, root, 4));
+  ASSERT_FALSE(verifyMerkleProof(fake_leaf, forged, root, 2));
+}
+
+/**
+ * @given tree large enough to be hashed in parallel
+ * @when proof is built for a leaf
+ * @then it is verified against the root and has logarithmic size
+ */
+TEST(Merkle, LargeTree) {
+  auto leaves = makeLeaves(5000);
+  auto root = merkleRoot(leaves);
+  auto proof = merkleProof(leaves, 4321);
+  ASSERT_TRUE(proof);
+  ASSERT_LE(proof->path.size(), 13);
+  ASSERT_TRUE(verifyMerkleProof(leaves.at(4321), *proof, root, 5000));
+}
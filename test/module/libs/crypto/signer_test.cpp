@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "crypto/signer.hpp"
+#include "crypto/crypto.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha;
+
+class SignerTest : public ::testing::Test {
+ public:
+  SignerTest() : keypair(create_keypair()), signer(keypair) {}
+
+  keypair_t keypair;
+  Signer signer;
+};
+
+/**
+ * @given signer for the keypair
+ * @when message is signed
+ * @then signature is the same as produced by iroha::sign and is valid
+ */
+TEST_F(SignerTest, SameAsPlainSign) {
+  std::string message = "c0a5cca43b8aa79eb50e3464bc839dd6";
+
+  auto signature = signer.sign(message);
+
+  ASSERT_EQ(sign(message, keypair.pubkey, keypair.privkey), signature);
+  ASSERT_TRUE(verify(message, signer.publicKey(), signature));
+}
+
+/**
+ * @given signer for the keypair
+ * @when batch larger than the parallel threshold is signed
+ * @then every signature matches the message at the same position
+ */
+TEST_F(SignerTest, BatchSign) {
+  std::vector<std::string> messages;
+  for (size_t i = 0; i < Signer::PARALLEL_BATCH * 2; ++i) {
+    messages.push_back("message " + std::to_string(i));
+  }
+
+  auto signatures = signer.sign(messages);
+
+  ASSERT_EQ(messages.size(), signatures.size());
+  for (size_t i = 0; i < messages.size(); ++i) {
+    ASSERT_EQ(sign(messages[i], keypair.pubkey, keypair.privkey),
+              signatures[i]);
+  }
+}
+
+/**
+ * @given signer for the keypair
+ * @when empty batch is signed
+ * @then no signatures are returned
+ */
+TEST_F(SignerTest, EmptyBatch) {
+  ASSERT_TRUE(signer.sign(std::vector<std::string>{}).empty());
+}
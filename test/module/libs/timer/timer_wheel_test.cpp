@@ -0,0 +1,147 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+
+#include "timer/timer_wheel.hpp"
+
+using namespace iroha;
+using namespace std::chrono_literals;
+
+class TimerWheelTest : public ::testing::Test {
+ public:
+  TimerWheel wheel;
+};
+
+/**
+ * @given timer wheel
+ * @when task is scheduled
+ * @then it is executed not earlier than its delay
+ */
+TEST_F(TimerWheelTest, TaskExecutedAfterDelay) {
+  std::promise<TimerWheel::Clock::time_point> fired;
+  auto start = TimerWheel::Clock::now();
+
+  wheel.schedule(20ms, [&fired] { fired.set_value(TimerWheel::Clock::now()); });
+
+  auto future = fired.get_future();
+  ASSERT_EQ(std::future_status::ready, future.wait_for(1s));
+  ASSERT_GE(future.get() - start, 20ms);
+  ASSERT_EQ(0, wheel.size());
+}
+
+/**
+ * @given timer wheel with scheduled task
+ * @when the task is cancelled before its deadline
+ * @then it is not executed
+ */
+TEST_F(TimerWheelTest, CancelledTaskNotExecuted) {
+  std::atomic<bool> fired{false};
+
+  auto handle = wheel.schedule(20ms, [&fired] { fired = true; });
+  handle.cancel();
+
+  std::this_thread::sleep_for(60ms);
+  ASSERT_FALSE(fired);
+}
+
+/**
+ * @given timer wheel
+ * @when tasks are scheduled in reverse order of their delays, some of them
+ * on the upper levels of the wheel
+ * @then they are executed in order of their deadlines
+ */
+TEST_F(TimerWheelTest, TasksExecutedInDeadlineOrder) {
+  std::mutex mutex;
+  std::vector<int> order;
+  std::promise<void> done;
+
+  auto task = [&](int id) {
+    return [&, id] {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(id);
+      if (order.size() == 3) {
+        done.set_value();
+      }
+    };
+  };
+  wheel.schedule(150ms, task(3));
+  wheel.schedule(70ms, task(2));
+  wheel.schedule(10ms, task(1));
+
+  ASSERT_EQ(std::future_status::ready, done.get_future().wait_for(2s));
+  ASSERT_EQ(std::vector<int>({1, 2, 3}), order);
+}
+
+/**
+ * @given timer wheel
+ * @when task schedules another task from the wheel thread
+ * @then the second task is executed as well
+ */
+TEST_F(TimerWheelTest, TaskScheduledFromTask) {
+  std::promise<void> done;
+
+  wheel.schedule(5ms, [this, &done] {
+    wheel.schedule(5ms, [&done] { done.set_value(); });
+  });
+
+  ASSERT_EQ(std::future_status::ready, done.get_future().wait_for(1s));
+}
+
+/**
+ * @given timer wheel with running task
+ * @when the task is cancelled with waiting
+ * @then cancellation returns only after the task is finished
+ */
+TEST_F(TimerWheelTest, CancelAndWaitWaitsForRunningTask) {
+  std::promise<void> started;
+  std::atomic<bool> finished{false};
+
+  auto handle = wheel.schedule(5ms, [&started, &finished] {
+    started.set_value();
+    std::this_thread::sleep_for(50ms);
+    finished = true;
+  });
+
+  ASSERT_EQ(std::future_status::ready, started.get_future().wait_for(1s));
+  wheel.cancelAndWait(handle);
+  ASSERT_TRUE(finished);
+}
+
+/**
+ * @given timer wheel
+ * @when task cancels itself with waiting
+ * @then it does not wait for itself
+ */
+TEST_F(TimerWheelTest, CancelAndWaitFromTask) {
+  std::promise<void> done;
+  TimerWheel::Handle handle;
+  std::mutex mutex;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    handle = wheel.schedule(5ms, [&] {
+      std::lock_guard<std::mutex> lock(mutex);
+      wheel.cancelAndWait(handle);
+      done.set_value();
+    });
+  }
+
+  ASSERT_EQ(std::future_status::ready, done.get_future().wait_for(1s));
+}